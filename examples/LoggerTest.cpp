@@ -2,7 +2,14 @@
 #include <memory>
 #include <thread>
 #include <chrono>
+#include <fstream>
+#include <filesystem>
 #include "Logger.h"
+#include "LogConfigWatcher.h"
+#ifdef __unix__
+#include "SharedMemoryDestination.h"
+#include "SharedMemoryCollector.h"
+#endif
 
 void testBasicLogging() {
     auto logger = LoggerManager().createLogger("TestLogger");
@@ -88,6 +95,174 @@ void testAssertions() {
     logger->stop();
 }
 
+void testTscClock() {
+    auto logger = LoggerManager().createLogger("TscLogger");
+    logger->setLogLevel(LogLevel::DEBUG);
+    logger->addDestination(std::make_unique<ConsoleDestination>());
+    logger->setClockMode(ClockMode::Tsc);
+    logger->start();
+
+    // Producers only read the tick counter; the backend thread converts it to wall-clock time.
+    for (int i = 0; i < 5; ++i) {
+        LOG_INFO(logger, "TSC timestamped message %d", i);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    logger->stop();
+}
+
+void testDuplicateSuppression() {
+    auto logger = LoggerManager().createLogger("DuplicateLogger");
+    logger->setLogLevel(LogLevel::DEBUG);
+    logger->addDestination(std::make_unique<ConsoleDestination>());
+    logger->setDuplicateSuppression(4, std::chrono::milliseconds(100));
+    logger->start();
+
+    // Prints the message once and then "A different message". The window of 4 keeps counting the
+    // repeats, and "message repeated 999 times: ..." follows after the summary interval or at stop().
+    for (int i = 0; i < 1000; ++i) {
+        LOG_ERROR(logger, "Connection to %s refused", "db1");
+    }
+    LOG_INFO(logger, "A different message");
+
+    logger->stop();
+}
+
+void testConfigReload() {
+    auto logger = LoggerManager().createLogger("ConfigLogger");
+    logger->addDestination(std::make_unique<ConsoleDestination>());
+    logger->start();
+
+    {
+        std::ofstream config("logger.conf");
+        config << "level = WARNING\n"
+               << "pattern = [%l] %v\n"
+               << "destination = console:nocolor\n";
+    }
+    LogConfigWatcher watcher(logger, "logger.conf", std::chrono::milliseconds(50));
+    watcher.start();
+
+    LOG_INFO(logger, "Filtered out by the configured level");
+    LOG_WARNING(logger, "Written with the configured pattern");
+
+    {
+        std::ofstream config("logger.conf");
+        config << "level = DEBUG\n"
+               << "pattern = <%l> %v\n";
+    }
+    watcher.reload();
+    LOG_DEBUG(logger, "Written with the reloaded level and pattern");
+
+    // Destinations can also be replaced directly while the logger is running.
+    std::vector<std::unique_ptr<LogDestination>> destinations;
+    destinations.push_back(std::make_unique<ConsoleDestination>());
+    logger->setDestinations(std::move(destinations));
+    LOG_INFO(logger, "Written to the replacement destination");
+
+    watcher.stop();
+    logger->stop();
+    std::filesystem::remove("logger.conf");
+}
+
+void testCategoryLevels() {
+    LoggerManager manager;
+    manager.setLevel("net", LogLevel::WARNING);
+    auto http = manager.createLogger("net.http");
+    auto tcp = manager.createLogger("net.tcp");
+    http->addDestination(std::make_unique<ConsoleDestination>());
+    tcp->addDestination(std::make_unique<ConsoleDestination>());
+    http->start();
+    tcp->start();
+
+    // Both loggers inherit WARNING from "net".
+    LOG_INFO(http, "Filtered out by the inherited level");
+    LOG_WARNING(tcp, "Written at the inherited level");
+
+    manager.setLevel("net.http", LogLevel::DEBUG);
+    LOG_DEBUG(http, "Written because net.http overrides net");
+    LOG_DEBUG(tcp, "Filtered out because net.tcp still inherits from net");
+    std::cout << "DEBUG enabled: net.http " << http->isEnabled(LogLevel::DEBUG)
+              << ", net.tcp " << tcp->isEnabled(LogLevel::DEBUG) << std::endl;
+
+    manager.resetLevel("net.http");
+    LOG_DEBUG(http, "Filtered out again after the override is reset");
+    std::cout << "net.http inherits WARNING again: "
+              << (manager.getEffectiveLevel("net.http") == LogLevel::WARNING) << std::endl;
+
+    http->stop();
+    tcp->stop();
+}
+
+#ifdef __unix__
+void testSharedMemoryLogging() {
+    // The collector normally runs as the logcollector process; here it shares the process with the worker.
+    SharedMemoryCollector collector("/logger-test", 4, 64 * 1024);
+    collector.addDestination(std::make_unique<ConsoleDestination>());
+    collector.start();
+
+    auto logger = LoggerManager().createLogger("SharedMemoryLogger");
+    logger->setLogLevel(LogLevel::INFO);
+    logger->addDestination(std::make_unique<SharedMemoryDestination>("/logger-test"));
+    logger->start();
+
+    for (int i = 0; i < 5; ++i) {
+        LOG_INFO(logger, "Shared memory message %d", i);
+    }
+
+    logger->stop();
+    collector.stop();
+    SharedMemorySegment::remove("/logger-test");
+}
+#endif
+
+void testMemoryBudget() {
+    LoggerManager manager;
+    manager.setMemoryBudget(4096);
+    auto logger = manager.createLogger("BudgetLogger");
+    logger->setLogLevel(LogLevel::DEBUG);
+    logger->addDestination(std::make_unique<ConsoleDestination>());
+
+    // Not started yet, so records pile up until the budget drops INFO and then samples WARNING.
+    for (int i = 0; i < 100; ++i) {
+        LOG_INFO(logger, "Queued info message %d", i);
+        LOG_WARNING(logger, "Queued warning message %d", i);
+    }
+    LOG_ERROR(logger, "Errors are always admitted");
+
+    auto stats = manager.getMemoryStats();
+    std::cout << "Queued " << stats.usedBytes << " bytes, dropped " << stats.droppedInfo << " info, sampled out "
+              << stats.sampledWarnings << " warnings, dropped " << stats.droppedWarnings << " warnings" << std::endl;
+
+    logger->start();
+    logger->stop();
+    std::cout << "Queued after stop: " << manager.getMemoryStats().usedBytes << " bytes" << std::endl;
+}
+
+void testRotationRecovery() {
+    std::filesystem::remove_all("rotation");
+    std::filesystem::create_directory("rotation");
+    FileRotationPolicy policy;
+    policy.maxFileSize = 256;
+    policy.maxFiles = 3;
+
+    {
+        FileDestination destination("rotation/app.service.log", policy);
+        for (int i = 0; i < 20; ++i) {
+            destination.write("Rotated message " + std::to_string(i));
+        }
+    }
+    std::cout << "Current segment: " << std::filesystem::read_symlink("rotation/app.service.log") << std::endl;
+
+    // A new destination picks up the sequence from the symlink instead of starting over.
+    {
+        FileDestination destination("rotation/app.service.log", policy);
+        destination.write("Message after restart");
+    }
+    for (const auto& entry : std::filesystem::directory_iterator("rotation")) {
+        std::cout << "  " << entry.path().filename() << std::endl;
+    }
+}
+
 int main() {
     std::cout << "Testing Basic Logging:" << std::endl;
     testBasicLogging();
@@ -101,6 +276,29 @@ int main() {
     std::cout << "\nTesting Multi-threaded Logging:" << std::endl;
     testMultiThreadedLogging();
 
+    std::cout << "\nTesting TSC Clock:" << std::endl;
+    testTscClock();
+
+    std::cout << "\nTesting Duplicate Suppression:" << std::endl;
+    testDuplicateSuppression();
+
+    std::cout << "\nTesting Config Reload:" << std::endl;
+    testConfigReload();
+
+    std::cout << "\nTesting Category Levels:" << std::endl;
+    testCategoryLevels();
+
+#ifdef __unix__
+    std::cout << "\nTesting Shared Memory Logging:" << std::endl;
+    testSharedMemoryLogging();
+#endif
+
+    std::cout << "\nTesting Memory Budget:" << std::endl;
+    testMemoryBudget();
+
+    std::cout << "\nTesting Rotation Recovery:" << std::endl;
+    testRotationRecovery();
+
     std::cout << "\nTesting Assertions:" << std::endl;
     testAssertions();
 
@@ -0,0 +1,96 @@
+#ifndef DUPLICATE_FILTER_H
+#define DUPLICATE_FILTER_H
+
+#include "LoggerPCH.h"
+
+namespace Core {
+
+/**
+ * @class DuplicateFilter
+ * @brief Collapses repeated log messages on the backend thread.
+ *
+ * DuplicateFilter remembers the last few distinct messages, keyed by format string,
+ * level and message text. Repeats of a remembered message are suppressed and counted;
+ * the count is reported as a summary once per summary interval, when the message falls
+ * out of the window, or when the filter is drained. With a window of one the summary
+ * reads "previous message repeated N times"; with a larger window other messages may
+ * come in between, so it reads "message repeated N times: <message>". The filter is not thread-safe and is only used by the backend thread.
+ */
+class LOGGER_API DuplicateFilter {
+public:
+    /**
+     * @struct Summary
+     * @brief A pending report of suppressed repeats.
+     */
+    struct Summary {
+        LogLevel level; ///< Level of the repeated message.
+        const char* file; ///< Source file of the repeated message.
+        int line; ///< Source line of the repeated message.
+        std::string message; ///< The summary text.
+    };
+
+    /**
+     * @brief Constructor for DuplicateFilter.
+     * @param window The number of distinct recent messages to remember; 1 collapses only consecutive repeats.
+     * @param summaryInterval How often a still-repeating message reports its count.
+     */
+    DuplicateFilter(size_t window, std::chrono::milliseconds summaryInterval);
+
+    /**
+     * @brief Checks whether a message repeats a remembered one.
+     * @param level The log level of the message.
+     * @param format The format string of the message, used as its id.
+     * @param file The source file of the message.
+     * @param line The source line of the message.
+     * @param message The formatted message text.
+     * @param now The current time.
+     * @param summaries Receives any summaries that must be written before the message.
+     * @return True if the message should be dropped.
+     */
+    bool suppress(LogLevel level, const char* format, const char* file, int line, const std::string& message,
+                  std::chrono::steady_clock::time_point now, std::vector<Summary>& summaries);
+
+    /**
+     * @brief Reports repeats whose summary interval has elapsed.
+     * @param now The current time.
+     * @param summaries Receives the due summaries.
+     */
+    void collectDue(std::chrono::steady_clock::time_point now, std::vector<Summary>& summaries);
+
+    /**
+     * @brief Reports all outstanding repeats and forgets every remembered message.
+     * @param summaries Receives the summaries.
+     */
+    void drain(std::vector<Summary>& summaries);
+
+    /**
+     * @brief Gets the summary interval.
+     * @return The interval between summaries of a still-repeating message.
+     */
+    std::chrono::milliseconds summaryInterval() const { return m_summaryInterval; }
+
+private:
+    struct Entry {
+        LogLevel level;
+        const char* format;
+        const char* file;
+        int line;
+        size_t hash;
+        std::string message;
+        size_t repeats;
+        std::chrono::steady_clock::time_point firstRepeat;
+    };
+
+    /**
+     * @brief Appends a summary for an entry and resets its repeat count.
+     */
+    void report(Entry& entry, std::vector<Summary>& summaries) const;
+
+    size_t m_window; ///< Maximum number of remembered messages.
+    std::chrono::milliseconds m_summaryInterval; ///< Interval between summaries.
+    std::vector<Entry> m_entries; ///< Remembered messages, most recently seen first.
+};
+
+} // namespace Core
+
+#endif // DUPLICATE_FILTER_H
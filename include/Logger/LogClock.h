@@ -0,0 +1,112 @@
+#ifndef LOG_CLOCK_H
+#define LOG_CLOCK_H
+
+#include "LoggerPCH.h"
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define LOGGER_HAS_RDTSC 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #include <x86intrin.h>
+    #include <cpuid.h>
+    #define LOGGER_HAS_RDTSC 1
+#endif
+
+namespace Core {
+
+/**
+ * @enum ClockMode
+ * @brief Selects how a Logger timestamps its messages.
+ */
+enum class ClockMode {
+    System, ///< Calls std::chrono::system_clock::now() on the logging thread.
+    Tsc     ///< Captures raw TSC ticks on the logging thread; converted on the backend thread.
+};
+
+/**
+ * @class TscClock
+ * @brief Converts raw TSC ticks into wall-clock time.
+ *
+ * Producers only read the time stamp counter, or steady_clock ticks when rdtsc is
+ * unavailable or the CPU does not report an invariant TSC. The backend thread owns a
+ * TscClock and turns those ticks into system_clock time points using a calibrated tick
+ * frequency that is periodically resynchronized against system_clock and steady_clock.
+ *
+ * Converted time points never go backwards, so records keep their order across
+ * resynchronizations. When system_clock steps backwards, converted time is not held
+ * still until the clock catches up; it runs slower than real time by a bounded rate
+ * until it has shed the difference.
+ *
+ * Assumes that the TSC is synchronized across cores, which holds on all x86 CPUs
+ * that report an invariant TSC.
+ */
+class LOGGER_API TscClock {
+public:
+    /**
+     * @brief Constructor for TscClock. Calibration is deferred to the first conversion.
+     */
+    TscClock();
+
+    /**
+     * @brief Reads the current tick count.
+     * @return The raw TSC value, or steady_clock ticks if usesTsc() is false.
+     */
+    static uint64_t now() noexcept {
+#ifdef LOGGER_HAS_RDTSC
+        if (usesTsc()) {
+            return __rdtsc();
+        }
+#endif
+        return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    }
+
+    /**
+     * @brief Reports whether now() reads the TSC.
+     * @return True if rdtsc is available and CPUID reports an invariant TSC.
+     */
+    static bool usesTsc() noexcept {
+        static const bool invariant = hasInvariantTsc();
+        return invariant;
+    }
+
+    /**
+     * @brief Converts a tick count captured by now() into a wall-clock time point.
+     * @param ticks The tick count to convert.
+     * @return The corresponding system_clock time point.
+     */
+    std::chrono::system_clock::time_point toSystemTime(uint64_t ticks);
+
+private:
+    /**
+     * @brief Checks CPUID leaf 0x80000007 for an invariant TSC (EDX bit 8).
+     */
+    static bool hasInvariantTsc() noexcept;
+
+    /**
+     * @brief Converts ticks with the current anchor, frequency and slew, without clamping.
+     */
+    std::chrono::system_clock::time_point convert(uint64_t ticks) const;
+
+    /**
+     * @brief Measures the initial tick frequency and sets the first anchor.
+     */
+    void calibrate();
+
+    /**
+     * @brief Re-anchors to the current wall-clock time and refines the tick frequency.
+     */
+    void resync();
+
+    uint64_t m_anchorTicks; ///< Tick count at the last anchor.
+    std::chrono::system_clock::time_point m_anchorTime; ///< Wall-clock time at the last anchor.
+    std::chrono::steady_clock::time_point m_anchorSteady; ///< Steady time at the last anchor.
+    double m_ticksPerNs; ///< Calibrated tick frequency; zero until calibrated.
+    uint64_t m_resyncTicks; ///< Number of ticks between resynchronizations.
+    double m_slewNs; ///< How far converted time is ahead of system_clock at the anchor, in nanoseconds.
+    std::chrono::system_clock::time_point m_lastTime; ///< Last converted time point.
+};
+
+} // namespace Core
+
+#endif // LOG_CLOCK_H
@@ -0,0 +1,98 @@
+#ifndef LOG_CONFIG_WATCHER_H
+#define LOG_CONFIG_WATCHER_H
+
+#include "LoggerPCH.h"
+#include <condition_variable>
+#include <filesystem>
+#include <thread>
+
+namespace Core {
+
+/**
+ * @class LogConfigWatcher
+ * @brief Applies a configuration file to a running Logger whenever the file changes.
+ *
+ * The file holds one `key = value` setting per line; blank lines and lines starting
+ * with `#` are ignored. Recognized keys:
+ *
+ * - `level`: DEBUG, INFO, WARNING, ERROR or FATAL. With a LoggerManager this sets the
+ *   root category, which every logger of the manager inherits unless a category overrides
+ *   it. Without one it is set directly on the logger, and a later LoggerManager::setLevel
+ *   or resetLevel covering that logger replaces it.
+ * - `level.<category>`: a level for a dotted category, applied through the LoggerManager.
+ *   Categories removed from the file are reset so they inherit again.
+ * - `pattern`: a PatternFormatter pattern.
+ * - `destination`: `console`, `console:nocolor` or `file:<path>:<maxFileSize>:<maxFiles>`.
+ *   May be repeated; the listed destinations replace the current ones.
+ *
+ * Keys missing from the file leave the corresponding setting untouched. Changes are
+ * applied through the Logger's snapshot setters, so the logger keeps running and
+ * queued records are not lost.
+ */
+class LOGGER_API LogConfigWatcher {
+public:
+    /**
+     * @brief Constructor for LogConfigWatcher.
+     * @param logger The logger to configure.
+     * @param path The configuration file to watch.
+     * @param pollInterval How often the file's modification time is checked.
+     */
+    LogConfigWatcher(std::shared_ptr<Logger> logger, const std::string& path,
+                     std::chrono::milliseconds pollInterval = std::chrono::seconds(1));
+
+    /**
+     * @brief Constructor for LogConfigWatcher that also applies category levels.
+     * @param manager The manager whose category levels are configured; must outlive the watcher.
+     * @param logger The logger whose formatter and destinations are configured.
+     * @param path The configuration file to watch.
+     * @param pollInterval How often the file's modification time is checked.
+     */
+    LogConfigWatcher(LoggerManager& manager, std::shared_ptr<Logger> logger, const std::string& path,
+                     std::chrono::milliseconds pollInterval = std::chrono::seconds(1));
+
+    /**
+     * @brief Destructor for LogConfigWatcher. Stops watching.
+     */
+    ~LogConfigWatcher();
+
+    /**
+     * @brief Applies the configuration file now and starts watching it for changes.
+     * @throws std::runtime_error if the initial configuration cannot be read or parsed.
+     */
+    void start();
+
+    /**
+     * @brief Stops watching the configuration file.
+     */
+    void stop();
+
+    /**
+     * @brief Reads the configuration file and applies it to the logger.
+     * @throws std::runtime_error if the file cannot be read or contains an invalid setting.
+     */
+    void reload();
+
+private:
+    /**
+     * @brief Watcher thread loop: polls the file and reloads it when it changes.
+     */
+    void watch();
+
+    LoggerManager* m_manager; ///< Manager receiving category levels, or nullptr.
+    std::shared_ptr<Logger> m_logger; ///< The logger being configured.
+    std::string m_path; ///< Path of the configuration file.
+    std::chrono::milliseconds m_pollInterval; ///< Interval between modification checks.
+    std::mutex m_reloadMutex; ///< Serializes reloads.
+    std::filesystem::file_time_type m_lastWriteTime; ///< Modification time of the last applied file.
+    std::string m_appliedPattern; ///< Last applied pattern, to skip unchanged formatters.
+    std::map<std::string, LogLevel> m_appliedCategories; ///< Category levels set by the last reload.
+    std::vector<std::string> m_appliedDestinations; ///< Last applied destination specs, to skip unchanged destinations.
+    std::thread m_watchThread; ///< The watcher thread.
+    std::mutex m_mutex; ///< Mutex for m_running and m_cv.
+    std::condition_variable m_cv; ///< Wakes the watcher thread on stop.
+    bool m_running; ///< Whether the watcher thread should keep running.
+};
+
+} // namespace Core
+
+#endif // LOG_CONFIG_WATCHER_H
@@ -2,6 +2,8 @@
 #define LOG_DESTINATION_H
 
 #include "LoggerPCH.h"
+#include <deque>
+#include <fstream>
 
 namespace Core {
 
@@ -25,6 +27,19 @@ public:
      */
     virtual void write(const std::string& message) = 0;
 
+    /**
+     * @brief Writes a log message together with the time it was logged.
+     *
+     * Logger calls this instead of write(). The default ignores the timestamp; destinations
+     * that order messages by log time override it.
+     * @param message The message to write.
+     * @param timestamp The time the message was logged.
+     */
+    virtual void writeTimestamped(const std::string& message, const std::chrono::system_clock::time_point& timestamp) {
+        (void)timestamp;
+        write(message);
+    }
+
     /**
      * @brief Flushes any buffered messages to the destination.
      */
@@ -61,12 +76,37 @@ private:
     bool m_useColor; ///< Indicates if color should be used in console output.
 };
 
+/**
+ * @enum RotationInterval
+ * @brief Time-based rotation schedule for FileDestination.
+ */
+enum class RotationInterval {
+    None,   ///< Rotate on size only.
+    Hourly, ///< Also rotate at the start of every local hour.
+    Daily   ///< Also rotate at local midnight.
+};
+
+/**
+ * @struct FileRotationPolicy
+ * @brief When FileDestination starts a new segment and which segments it keeps.
+ */
+struct FileRotationPolicy {
+    size_t maxFileSize = 10 * 1024 * 1024; ///< Rotate once a segment exceeds this many bytes.
+    int maxFiles = 5; ///< Keep at most this many segments, including the current one.
+    RotationInterval interval = RotationInterval::None; ///< Additional time-based rotation.
+    size_t maxTotalSize = 0; ///< Delete the oldest segments while all of them together exceed this; 0 for no limit.
+};
+
 /**
  * @class FileDestination
  * @brief Outputs log messages to a file with rotation.
  *
- * The FileDestination class handles writing log messages to a file,
- * with support for rotating log files based on size and number of files.
+ * The FileDestination class handles writing log messages to sequence-numbered
+ * segments named `<filename>.<sequence>`, with `<filename>` itself a symlink to the
+ * current segment. Rotation opens the next segment, repoints the symlink and deletes
+ * the oldest segment, so its cost does not depend on the number of files kept. On
+ * startup the sequence is recovered from the symlink; a plain file left at
+ * `<filename>` becomes the first segment.
  */
 class FileDestination : public LogDestination {
 public:
@@ -78,6 +118,13 @@ public:
      */
     FileDestination(const std::string& filename, size_t maxFileSize, int maxFiles);
 
+    /**
+     * @brief Constructor for FileDestination with a full rotation policy.
+     * @param filename The base filename for the log files.
+     * @param policy When to rotate and which segments to keep.
+     */
+    FileDestination(const std::string& filename, const FileRotationPolicy& policy);
+
     /**
      * @brief Destructor for FileDestination.
      */
@@ -105,9 +152,44 @@ private:
      */
     void rotateLogFiles();
 
+    /**
+     * @brief Recovers the current sequence and retained segments from a previous run.
+     */
+    void recoverSegments();
+
+    /**
+     * @brief Builds the path of a segment.
+     * @param sequence The segment's sequence number.
+     */
+    std::string segmentPath(uint64_t sequence) const;
+
+    /**
+     * @brief Points the `<filename>` symlink at the current segment.
+     */
+    void updateCurrentLink();
+
+    /**
+     * @brief Deletes the oldest segments until the count and total size limits hold.
+     */
+    void enforceRetention();
+
+    /**
+     * @brief Computes when the next time-based rotation is due.
+     */
+    void scheduleNextRotation();
+
+    /**
+     * @brief Rotates a recovered segment that was last written before the current hour or day began.
+     */
+    void rotateIfStale();
+
     std::string m_filename; ///< The base filename for log files.
-    size_t m_maxFileSize; ///< Maximum size for a single log file.
-    int m_maxFiles; ///< Maximum number of log files to keep.
+    FileRotationPolicy m_policy; ///< Rotation and retention settings.
+    uint64_t m_sequence; ///< Sequence number of the current segment.
+    size_t m_currentSize; ///< Bytes in the current segment.
+    std::deque<std::pair<uint64_t, size_t>> m_retained; ///< Older segments kept, oldest first, with their sizes.
+    size_t m_retainedSize; ///< Total size of m_retained.
+    std::chrono::system_clock::time_point m_nextRotation; ///< When the next time-based rotation is due.
     std::ofstream m_logFile; ///< Output file stream for logging.
 };
 
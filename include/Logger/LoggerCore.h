@@ -2,6 +2,9 @@
 #define LOGGERCORE_H
 
 #include "LoggerPCH.h"
+#include "LogClock.h"
+#include "DuplicateFilter.h"
+#include "MemoryBudget.h"
 
 /**
  * @class Logger
@@ -10,6 +13,11 @@
  * The Logger class manages the logging system, allowing users to set log levels,
  * add destinations, and format messages. It includes a thread-safe queue for
  * handling log messages asynchronously.
+ *
+ * The formatter and destinations are published together as an immutable snapshot.
+ * Reconfiguration copies the current snapshot, modifies the copy and publishes it;
+ * the backend thread picks the new snapshot up before its next message without
+ * taking a lock, so the logger can be reconfigured while it is running.
  */
 class Logger {
 public:
@@ -35,12 +43,52 @@ public:
      */
     void addDestination(std::unique_ptr<LogDestination> destination);
 
+    /**
+     * @brief Replaces all destinations for log messages.
+     *
+     * Records already queued are written to the new destinations; the old ones are
+     * flushed and released once the backend thread has switched over.
+     * @param destinations The new set of destinations.
+     */
+    void setDestinations(std::vector<std::unique_ptr<LogDestination>> destinations);
+
     /**
      * @brief Sets the formatter for log messages.
      * @param formatter A unique pointer to a LogFormatter object.
      */
     void setFormatter(std::unique_ptr<LogFormatter> formatter);
 
+    /**
+     * @brief Sets the clock used to timestamp log messages.
+     * @param mode ClockMode::System reads system_clock on every call; ClockMode::Tsc
+     *             captures TSC ticks and converts them on the backend thread.
+     */
+    void setClockMode(ClockMode mode);
+
+    /**
+     * @brief Enables collapsing of repeated messages on the backend thread.
+     *
+     * Must be called while the logger is stopped.
+     * @param window The number of distinct recent messages to compare against; 0 disables suppression.
+     * @param summaryInterval How often a still-repeating message reports its repeat count.
+     */
+    void setDuplicateSuppression(size_t window, std::chrono::milliseconds summaryInterval = std::chrono::seconds(1));
+
+    /**
+     * @brief Charges this logger's queued records to a shared memory budget.
+     *
+     * Must be called before anything is logged; LoggerManager does this for the loggers it creates.
+     * @param budget The budget to charge, or nullptr for none.
+     */
+    void setMemoryBudget(std::shared_ptr<MemoryBudget> budget);
+
+    /**
+     * @brief Checks whether messages of a level are currently logged.
+     * @param level The level to check.
+     * @return True if messages of this level pass the logger's level.
+     */
+    bool isEnabled(LogLevel level) const;
+
     /**
      * @brief Logs a message with the given level.
      * @param level The severity level of the log message.
@@ -63,7 +111,108 @@ public:
     void stop();
 
 private:
-    // Member variables and helper methods
+    /**
+     * @class ThreadSafeQueue
+     * @brief A mutex-protected FIFO queue handing log records to the backend thread.
+     */
+    template<typename T>
+    class ThreadSafeQueue {
+    public:
+        void enqueue(T item);
+        T dequeue();
+        bool dequeueFor(T& item, std::chrono::milliseconds timeout);
+        bool tryDequeue(T& item);
+        bool empty() const;
+
+    private:
+        std::queue<T> m_queue; ///< Pending items.
+        mutable std::mutex m_mutex; ///< Mutex protecting the queue.
+        std::condition_variable m_cv; ///< Signals the consumer when items arrive.
+    };
+
+    /**
+     * @struct Sinks
+     * @brief An immutable snapshot of the formatter and destinations.
+     */
+    struct Sinks {
+        std::shared_ptr<const LogFormatter> formatter; ///< Formatter applied on the backend thread.
+        std::vector<std::shared_ptr<LogDestination>> destinations; ///< Output destinations.
+    };
+
+    /**
+     * @struct LogRecord
+     * @brief An unformatted log message travelling from the producer to the backend thread.
+     */
+    struct LogRecord {
+        LogLevel level; ///< Severity of the message.
+        ClockMode clockMode; ///< Which of ticks or timestamp is valid.
+        uint64_t ticks; ///< Raw TSC ticks when clockMode is ClockMode::Tsc.
+        std::chrono::system_clock::time_point timestamp; ///< Wall-clock time when clockMode is ClockMode::System.
+        const char* format; ///< Format string of the log call; identifies the message for duplicate suppression.
+        const char* file; ///< Source file of the log call.
+        int line; ///< Source line of the log call.
+        std::string message; ///< The printf-formatted message.
+        size_t budgetBytes = 0; ///< Bytes charged to the memory budget, released once written.
+        bool shutdown = false; ///< Tells the backend thread to exit.
+    };
+
+    /**
+     * @brief Backend thread loop: dequeues records and writes them until shutdown.
+     */
+    void processLogQueue();
+
+    /**
+     * @brief Empties the queue without a backend thread, returning every record's budget charge.
+     * @param write Whether to write the records or discard them.
+     */
+    void drainQueue(bool write);
+
+    /**
+     * @brief Converts the timestamp, formats a record and writes it to every destination.
+     * @param record The record to write.
+     */
+    void writeRecord(const LogRecord& record);
+
+    /**
+     * @brief Formats a message and writes it to every destination.
+     */
+    void writeMessage(LogLevel level, const std::chrono::system_clock::time_point& timestamp,
+                      const char* file, int line, const std::string& message);
+
+    /**
+     * @brief Publishes a modified copy of the current sinks snapshot.
+     * @param modify Applied to the copy before it is published.
+     */
+    template<typename Modify>
+    void updateSinks(Modify modify);
+
+    /**
+     * @brief Switches the backend thread to the latest published sinks snapshot if it changed.
+     */
+    void refreshSinks();
+
+    /**
+     * @brief Writes and clears pending duplicate-suppression summaries.
+     * @param summaries The summaries to write.
+     */
+    void writeSummaries(std::vector<DuplicateFilter::Summary>& summaries);
+
+    template<typename... Args>
+    static std::string formatString(const char* format, Args... args);
+
+    std::atomic<LogLevel> m_logLevel; ///< Minimum level that is logged.
+    std::atomic<ClockMode> m_clockMode; ///< Clock used to timestamp new records.
+    std::shared_ptr<const Sinks> m_sinks; ///< Latest published snapshot; accessed with std::atomic_load/atomic_store.
+    std::atomic<uint64_t> m_sinksGeneration; ///< Incremented after each publish.
+    std::mutex m_configMutex; ///< Serializes writers of m_sinks; never taken by the backend thread.
+    std::shared_ptr<const Sinks> m_activeSinks; ///< Snapshot in use by the backend thread.
+    uint64_t m_activeGeneration; ///< Generation of m_activeSinks.
+    ThreadSafeQueue<LogRecord> m_logQueue; ///< Records waiting for the backend thread.
+    std::shared_ptr<MemoryBudget> m_memoryBudget; ///< Optional budget charged for queued records.
+    std::unique_ptr<DuplicateFilter> m_duplicateFilter; ///< Optional repeat suppression, used by the backend thread.
+    TscClock m_tscClock; ///< Tick converter, used only by the backend thread.
+    std::thread m_workerThread; ///< The backend thread.
+    std::atomic<bool> m_running; ///< Whether the backend thread is running.
 };
 
 #endif // LOGGERCORE_H
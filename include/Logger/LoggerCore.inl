@@ -21,23 +21,55 @@ T Logger::ThreadSafeQueue<T>::dequeue() {
     return item;
 }
 
+template<typename T>
+bool Logger::ThreadSafeQueue<T>::dequeueFor(T& item, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (!m_cv.wait_for(lock, timeout, [this] { return !m_queue.empty(); })) return false;
+    item = std::move(m_queue.front());
+    m_queue.pop();
+    return true;
+}
+
+template<typename T>
+bool Logger::ThreadSafeQueue<T>::tryDequeue(T& item) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_queue.empty()) return false;
+    item = std::move(m_queue.front());
+    m_queue.pop();
+    return true;
+}
+
 template<typename T>
 bool Logger::ThreadSafeQueue<T>::empty() const {
     std::lock_guard<std::mutex> lock(m_mutex);
     return m_queue.empty();
 }
 
+inline bool Logger::isEnabled(LogLevel level) const {
+    return level >= m_logLevel.load(std::memory_order_relaxed);
+}
+
 template<typename... Args>
 void Logger::log(LogLevel level, const char* file, int line, const char* format, Args... args) {
     if (level < m_logLevel.load(std::memory_order_relaxed)) return;
-    std::string message = formatString(format, args...);
-    auto timestamp = std::chrono::system_clock::now();
-    std::string formattedMessage;
-    {
-        std::lock_guard<std::mutex> lock(m_formatterMutex);
-        formattedMessage = m_formatter->format(level, timestamp, file, line, message);
+    // Stamp the record before formatting or waiting for budget, so neither delays its time.
+    ClockMode clockMode = m_clockMode.load(std::memory_order_relaxed);
+    uint64_t ticks = 0;
+    std::chrono::system_clock::time_point timestamp;
+    if (clockMode == ClockMode::Tsc) {
+        ticks = TscClock::now();
+    } else {
+        timestamp = std::chrono::system_clock::now();
+    }
+    // Under memory pressure, drop low-severity records before paying for formatting.
+    if (m_memoryBudget && m_memoryBudget->enabled() && !m_memoryBudget->admits(level)) return;
+    LogRecord record{level, clockMode, ticks, timestamp, format, file, line, formatString(format, args...)};
+    if (m_memoryBudget && m_memoryBudget->enabled()) {
+        size_t bytes = sizeof(LogRecord) + record.message.size();
+        if (!m_memoryBudget->acquire(level, bytes)) return;
+        record.budgetBytes = bytes;
     }
-    m_logQueue.enqueue(std::move(formattedMessage));
+    m_logQueue.enqueue(std::move(record));
 }
 
 template<typename... Args>
@@ -38,7 +38,10 @@
  * @param ... The message format and arguments.
  */
 #define LOG_DEBUG(logger, ...) do { \
-    logger->log(LogLevel::DEBUG, __FILE__, __LINE__, __VA_ARGS__); \
+    auto&& loggerInstance_ = (logger); \
+    if (loggerInstance_->isEnabled(LogLevel::DEBUG)) { \
+        loggerInstance_->log(LogLevel::DEBUG, __FILE__, __LINE__, __VA_ARGS__); \
+    } \
 } while(0)
 
 /**
@@ -47,7 +50,10 @@
  * @param ... The message format and arguments.
  */
 #define LOG_INFO(logger, ...) do { \
-    logger->log(LogLevel::INFO, __FILE__, __LINE__, __VA_ARGS__); \
+    auto&& loggerInstance_ = (logger); \
+    if (loggerInstance_->isEnabled(LogLevel::INFO)) { \
+        loggerInstance_->log(LogLevel::INFO, __FILE__, __LINE__, __VA_ARGS__); \
+    } \
 } while(0)
 
 /**
@@ -56,7 +62,10 @@
  * @param ... The message format and arguments.
  */
 #define LOG_WARNING(logger, ...) do { \
-    logger->log(LogLevel::WARNING, __FILE__, __LINE__, __VA_ARGS__); \
+    auto&& loggerInstance_ = (logger); \
+    if (loggerInstance_->isEnabled(LogLevel::WARNING)) { \
+        loggerInstance_->log(LogLevel::WARNING, __FILE__, __LINE__, __VA_ARGS__); \
+    } \
 } while(0)
 
 /**
@@ -65,7 +74,10 @@
  * @param ... The message format and arguments.
  */
 #define LOG_ERROR(logger, ...) do { \
-    logger->log(LogLevel::ERROR, __FILE__, __LINE__, __VA_ARGS__); \
+    auto&& loggerInstance_ = (logger); \
+    if (loggerInstance_->isEnabled(LogLevel::ERROR)) { \
+        loggerInstance_->log(LogLevel::ERROR, __FILE__, __LINE__, __VA_ARGS__); \
+    } \
 } while(0)
 
 /**
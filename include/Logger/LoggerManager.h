@@ -12,6 +12,12 @@ namespace Core {
  * The LoggerManager class provides functionality to create, retrieve, and manage
  * Logger instances. It ensures unique logger names and handles thread-safe access
  * to loggers.
+ *
+ * Logger names are dotted hierarchical categories such as `net.http.client`. A level
+ * set on a category applies to every logger below it unless a more specific category
+ * overrides it; the empty category is the root. Resolved levels are pushed into each
+ * Logger when they change, so checking whether a message is enabled stays a single
+ * atomic load regardless of how many categories exist.
  */
 class LOGGER_API LoggerManager {
 public:
@@ -35,8 +41,53 @@ public:
      */
     void removeLogger(const std::string& name);
 
+    /**
+     * @brief Sets the level of a category and, unless overridden, of everything below it.
+     * @param category The dotted category name; the empty string is the root.
+     * @param level The log level to set.
+     */
+    void setLevel(const std::string& category, LogLevel level);
+
+    /**
+     * @brief Removes a category's level so that it inherits from its parent again.
+     * @param category The dotted category name; the empty string is the root.
+     */
+    void resetLevel(const std::string& category);
+
+    /**
+     * @brief Resolves the level that applies to a category.
+     * @param category The dotted category name.
+     * @return The level of the nearest configured ancestor, or LogLevel::INFO if none is configured.
+     */
+    LogLevel getEffectiveLevel(const std::string& category);
+
+    /**
+     * @brief Limits the memory held by queued records across all loggers of this manager.
+     * @param limitBytes The memory limit in bytes; 0 removes the limit.
+     * @param policy How to escalate as usage approaches the limit.
+     */
+    void setMemoryBudget(size_t limitBytes, const MemoryBudget::Policy& policy = MemoryBudget::Policy());
+
+    /**
+     * @brief Gets memory usage and the actions the budget has taken.
+     * @return A snapshot of the budget's statistics.
+     */
+    MemoryBudget::Stats getMemoryStats() const;
+
 private:
+    /**
+     * @brief Resolves a category's level. The caller must hold m_mutex.
+     */
+    LogLevel resolveLevel(const std::string& category) const;
+
+    /**
+     * @brief Pushes resolved levels into every logger at or below a category. The caller must hold m_mutex.
+     */
+    void applyLevels(const std::string& category);
+
     std::map<std::string, std::shared_ptr<Logger>> m_loggers; ///< Map of logger names to Logger instances.
+    std::shared_ptr<MemoryBudget> m_memoryBudget = std::make_shared<MemoryBudget>(); ///< Budget shared by all loggers.
+    std::map<std::string, LogLevel> m_levels; ///< Configured category levels.
     std::mutex m_mutex; ///< Mutex for thread-safe access to loggers.
 };
 
@@ -0,0 +1,131 @@
+#ifndef MEMORY_BUDGET_H
+#define MEMORY_BUDGET_H
+
+#include "LoggerPCH.h"
+#include <condition_variable>
+
+namespace Core {
+
+/**
+ * @class MemoryBudget
+ * @brief Bounds the memory held by queued log records across a set of loggers.
+ *
+ * Every queued record is charged to the budget when it is logged and released once the
+ * backend thread has written it. As usage grows the budget escalates:
+ *
+ * 1. Above Policy::dropDebugInfoAt of the limit, DEBUG and INFO records are dropped.
+ * 2. Above Policy::sampleWarningAt, only one WARNING in Policy::warningSampleRate is kept;
+ *    at the limit all warnings are dropped.
+ * 3. At the limit, ERROR and FATAL producers wait up to Policy::blockTimeout for room and
+ *    are then admitted anyway, so the most important records are never lost.
+ *
+ * Every action is counted in Stats. A limit of zero disables the budget.
+ */
+class LOGGER_API MemoryBudget {
+public:
+    /**
+     * @struct Policy
+     * @brief Escalation thresholds, as fractions of the limit.
+     */
+    struct Policy {
+        double dropDebugInfoAt = 0.5; ///< Usage above which DEBUG and INFO are dropped.
+        double sampleWarningAt = 0.75; ///< Usage above which WARNING is sampled.
+        unsigned warningSampleRate = 10; ///< Keep one WARNING in this many while sampling.
+        std::chrono::milliseconds blockTimeout{100}; ///< Longest wait for ERROR/FATAL producers at the limit.
+    };
+
+    /**
+     * @struct Stats
+     * @brief A snapshot of usage and of the actions taken.
+     */
+    struct Stats {
+        size_t usedBytes; ///< Bytes currently charged.
+        size_t peakBytes; ///< Highest charge seen.
+        uint64_t droppedDebug; ///< DEBUG records dropped.
+        uint64_t droppedInfo; ///< INFO records dropped.
+        uint64_t sampledWarnings; ///< WARNING records dropped by sampling.
+        uint64_t droppedWarnings; ///< WARNING records dropped at the limit.
+        uint64_t blockedProducers; ///< ERROR/FATAL producers that had to wait.
+        uint64_t blockTimeouts; ///< Waits that timed out and were admitted over the limit.
+    };
+
+    /**
+     * @brief Constructor for MemoryBudget. The budget starts disabled.
+     */
+    MemoryBudget();
+
+    /**
+     * @brief Sets the limit and escalation policy.
+     * @param limitBytes The memory limit in bytes; 0 disables the budget.
+     * @param policy The escalation policy.
+     */
+    void configure(size_t limitBytes, const Policy& policy);
+
+    /**
+     * @brief Checks whether the budget is enforced.
+     * @return True if a limit is set.
+     */
+    bool enabled() const { return m_limit.load(std::memory_order_relaxed) != 0; }
+
+    /**
+     * @brief Cheaply rejects records whose level is already being dropped at the current usage.
+     *
+     * Lets producers skip formatting a record that acquire() would drop anyway; the drop is
+     * counted here. A true result does not guarantee that acquire() admits the record.
+     * @param level The level of the record.
+     * @return False if the record must be dropped.
+     */
+    bool admits(LogLevel level);
+
+    /**
+     * @brief Charges a record to the budget, applying the escalation policy.
+     *
+     * May block an ERROR or FATAL producer for up to Policy::blockTimeout.
+     * @param level The level of the record.
+     * @param bytes The memory the record holds while queued.
+     * @return True if the record was admitted and must later be released; false if it was dropped.
+     */
+    bool acquire(LogLevel level, size_t bytes);
+
+    /**
+     * @brief Returns the memory of a written record to the budget.
+     * @param bytes The amount previously passed to a successful acquire().
+     */
+    void release(size_t bytes);
+
+    /**
+     * @brief Gets the current usage and action counters.
+     * @return A snapshot of the statistics.
+     */
+    Stats stats() const;
+
+private:
+    /**
+     * @brief Adds a charge and updates the peak.
+     */
+    void charge(size_t bytes);
+
+    std::atomic<size_t> m_limit; ///< Limit in bytes; 0 when disabled.
+    std::atomic<size_t> m_dropThreshold; ///< Usage above which DEBUG/INFO are dropped.
+    std::atomic<size_t> m_sampleThreshold; ///< Usage above which WARNING is sampled.
+    std::atomic<unsigned> m_warningSampleRate; ///< Keep one WARNING in this many while sampling.
+    std::atomic<int64_t> m_blockTimeoutMs; ///< Longest wait for ERROR/FATAL producers.
+
+    std::atomic<size_t> m_used; ///< Bytes currently charged.
+    std::atomic<size_t> m_peak; ///< Highest charge seen.
+    std::atomic<uint64_t> m_warningCounter; ///< Counts sampled warnings to pick one in N.
+    std::atomic<uint64_t> m_droppedDebug; ///< See Stats.
+    std::atomic<uint64_t> m_droppedInfo; ///< See Stats.
+    std::atomic<uint64_t> m_sampledWarnings; ///< See Stats.
+    std::atomic<uint64_t> m_droppedWarnings; ///< See Stats.
+    std::atomic<uint64_t> m_blockedProducers; ///< See Stats.
+    std::atomic<uint64_t> m_blockTimeouts; ///< See Stats.
+
+    std::atomic<int> m_waiters; ///< Number of blocked producers.
+    std::mutex m_mutex; ///< Mutex for m_cv.
+    std::condition_variable m_cv; ///< Wakes blocked producers when memory is released.
+};
+
+} // namespace Core
+
+#endif // MEMORY_BUDGET_H
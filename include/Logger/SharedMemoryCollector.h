@@ -0,0 +1,101 @@
+#ifndef SHARED_MEMORY_COLLECTOR_H
+#define SHARED_MEMORY_COLLECTOR_H
+
+#include "LoggerPCH.h"
+#include "LogDestination.h"
+#include "SharedMemoryLog.h"
+#include <condition_variable>
+#include <thread>
+
+namespace Core {
+
+/**
+ * @class SharedMemoryCollector
+ * @brief Merges the rings of a shared-memory log segment into ordinary destinations.
+ *
+ * The collector owns the segment that SharedMemoryDestination instances in other
+ * processes write to. Its thread repeatedly takes the oldest pending record across
+ * all rings, by the time it was logged, and writes it to every destination, so only this process
+ * touches the disk. Rings whose producer process has died are drained and then freed
+ * for reuse, and drop counts reported by producers are logged as messages.
+ */
+class LOGGER_API SharedMemoryCollector {
+public:
+    /**
+     * @brief Constructor for SharedMemoryCollector. Creates or reattaches to the segment.
+     * @param segmentName The POSIX shared-memory name, e.g. "/myapp-log".
+     * @param slotCount The maximum number of producers.
+     * @param ringCapacity The data bytes per producer ring.
+     * @param pollInterval How long to sleep when every ring is empty.
+     * @throws std::runtime_error if the segment cannot be created.
+     */
+    SharedMemoryCollector(const std::string& segmentName, uint32_t slotCount = 64, uint32_t ringCapacity = 1 << 20,
+                          std::chrono::milliseconds pollInterval = std::chrono::milliseconds(10));
+
+    /**
+     * @brief Destructor for SharedMemoryCollector. Stops collecting.
+     */
+    ~SharedMemoryCollector();
+
+    /**
+     * @brief Adds a destination for collected messages. Must be called before start().
+     * @param destination A unique pointer to a LogDestination object.
+     */
+    void addDestination(std::unique_ptr<LogDestination> destination);
+
+    /**
+     * @brief Starts the collector thread.
+     */
+    void start();
+
+    /**
+     * @brief Drains all rings, reports outstanding drops and stops the collector thread.
+     */
+    void stop();
+
+    /**
+     * @brief Writes every record currently in the rings, oldest first.
+     * @return The number of records written.
+     */
+    size_t collect();
+
+private:
+    /**
+     * @brief Collector thread loop.
+     */
+    void run();
+
+    /**
+     * @brief Reports dropped records and frees the rings of dead producers.
+     */
+    void checkProducers();
+
+    /**
+     * @brief Finds the next record in a ring, skipping padding.
+     * @param slot The ring index.
+     * @param head The write position to read up to, loaded with acquire ordering.
+     * @param header Receives the record header.
+     * @return True if the ring holds a record before head.
+     */
+    bool peek(uint32_t slot, uint64_t head, SharedRecordHeader& header);
+
+    /**
+     * @brief Writes a message to every destination.
+     * @param message The message to write.
+     * @param timestamp The time the message was logged.
+     */
+    void writeMessage(const std::string& message, const std::chrono::system_clock::time_point& timestamp);
+
+    std::unique_ptr<SharedMemorySegment> m_segment; ///< The mapped segment.
+    std::vector<std::unique_ptr<LogDestination>> m_destinations; ///< Output destinations.
+    std::chrono::milliseconds m_pollInterval; ///< Sleep between polls of empty rings.
+    std::chrono::steady_clock::time_point m_lastProducerCheck; ///< Time of the last checkProducers().
+    std::thread m_collectThread; ///< The collector thread.
+    std::mutex m_mutex; ///< Mutex for m_running and m_cv.
+    std::condition_variable m_cv; ///< Wakes the collector thread on stop.
+    bool m_running; ///< Whether the collector thread should keep running.
+};
+
+} // namespace Core
+
+#endif // SHARED_MEMORY_COLLECTOR_H
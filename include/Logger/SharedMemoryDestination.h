@@ -0,0 +1,64 @@
+#ifndef SHARED_MEMORY_DESTINATION_H
+#define SHARED_MEMORY_DESTINATION_H
+
+#include "LoggerPCH.h"
+#include "LogDestination.h"
+#include "SharedMemoryLog.h"
+
+namespace Core {
+
+/**
+ * @class SharedMemoryDestination
+ * @brief Outputs log messages to a shared-memory ring read by a collector process.
+ *
+ * Each SharedMemoryDestination claims its own ring in a segment created by a
+ * SharedMemoryCollector (see the logcollector tool), so a write is a copy into shared
+ * memory and never blocks or touches the disk. When the ring is full the message is
+ * dropped and counted in the ring, and the collector reports the count.
+ *
+ * Create the destination in each worker process after fork(); a destination inherited
+ * across fork() would be shared by two producers.
+ */
+class LOGGER_API SharedMemoryDestination : public LogDestination {
+public:
+    /**
+     * @brief Constructor for SharedMemoryDestination.
+     * @param segmentName The POSIX shared-memory name used by the collector.
+     * @throws std::runtime_error if the segment does not exist or has no free ring.
+     */
+    explicit SharedMemoryDestination(const std::string& segmentName);
+
+    /**
+     * @brief Destructor for SharedMemoryDestination. Releases the ring; the collector drains what is left.
+     */
+    ~SharedMemoryDestination();
+
+    /**
+     * @brief Copies a log message into the ring, stamped with the current time.
+     * @param message The message to write.
+     */
+    void write(const std::string& message) override;
+
+    /**
+     * @brief Copies a log message into the ring with the time it was logged, which the collector merges by.
+     * @param message The message to write.
+     * @param timestamp The time the message was logged.
+     */
+    void writeTimestamped(const std::string& message, const std::chrono::system_clock::time_point& timestamp) override;
+
+    /**
+     * @brief Does nothing; messages are visible to the collector as soon as they are written.
+     */
+    void flush() override;
+
+private:
+    std::unique_ptr<SharedMemorySegment> m_segment; ///< The mapped segment.
+    uint32_t m_slot; ///< Index of the claimed ring.
+    SharedRing* m_ring; ///< Control block of the claimed ring.
+    char* m_data; ///< Data area of the claimed ring.
+    uint64_t m_mask; ///< Ring capacity minus one.
+};
+
+} // namespace Core
+
+#endif // SHARED_MEMORY_DESTINATION_H
@@ -0,0 +1,132 @@
+#ifndef SHARED_MEMORY_LOG_H
+#define SHARED_MEMORY_LOG_H
+
+#include "LoggerPCH.h"
+#include <cstdint>
+
+namespace Core {
+
+/**
+ * @struct SharedRing
+ * @brief Control block of one single-producer/single-consumer ring in a shared-memory segment.
+ *
+ * Positions are monotonically increasing byte counts; the offset into the ring's data
+ * is the position modulo the ring capacity. Each record is laid out as a
+ * SharedRecordHeader followed by the message bytes, padded to 8 bytes. A record that
+ * does not fit before the end of the data is preceded by a padding marker that tells
+ * the reader to skip to the start.
+ */
+struct SharedRing {
+    alignas(64) std::atomic<int32_t> owner; ///< PID of the producing process, or 0 if the slot is free.
+    std::atomic<uint64_t> dropped; ///< Records dropped because the ring was full and not yet reported.
+    alignas(64) std::atomic<uint64_t> head; ///< Write position, advanced by the producer.
+    alignas(64) std::atomic<uint64_t> tail; ///< Read position, advanced by the collector.
+};
+
+/**
+ * @struct SharedRecordHeader
+ * @brief Header preceding each message in a SharedRing.
+ */
+struct SharedRecordHeader {
+    uint32_t size; ///< Message size in bytes, or kPaddingMarker.
+    uint32_t reserved; ///< Keeps the timestamp 8-byte aligned.
+    int64_t timestamp; ///< Time the record was logged, in nanoseconds since the epoch.
+
+    static constexpr uint32_t kPaddingMarker = 0xFFFFFFFFu; ///< Marks the unused tail of the ring.
+};
+
+/**
+ * @struct SharedSegmentHeader
+ * @brief Header at the start of a shared-memory log segment.
+ */
+struct SharedSegmentHeader {
+    static constexpr uint64_t kMagic = 0x4C4F4753484D3031ull; ///< "LOGSHM01".
+
+    std::atomic<uint64_t> magic; ///< kMagic once the segment is initialized.
+    uint32_t slotCount; ///< Number of rings in the segment.
+    uint32_t ringCapacity; ///< Data bytes per ring; a power of two.
+};
+
+/**
+ * @class SharedMemorySegment
+ * @brief Maps a POSIX shared-memory log segment into the process.
+ *
+ * The collector creates the segment; producers attach to an existing one. A segment
+ * holds a SharedSegmentHeader followed by slotCount rings, each a SharedRing control
+ * block followed by ringCapacity bytes of data.
+ */
+class LOGGER_API SharedMemorySegment {
+public:
+    /**
+     * @brief Creates the segment, or attaches to it if it already exists with the same geometry.
+     * @param name The POSIX shared-memory name, e.g. "/myapp-log".
+     * @param slotCount The number of rings.
+     * @param ringCapacity The data bytes per ring; rounded up to a power of two.
+     * @return The mapped segment.
+     * @throws std::runtime_error if the segment cannot be created or mapped.
+     */
+    static std::unique_ptr<SharedMemorySegment> create(const std::string& name, uint32_t slotCount, uint32_t ringCapacity);
+
+    /**
+     * @brief Attaches to a segment created by a collector.
+     * @param name The POSIX shared-memory name.
+     * @return The mapped segment.
+     * @throws std::runtime_error if the segment does not exist or is not initialized.
+     */
+    static std::unique_ptr<SharedMemorySegment> attach(const std::string& name);
+
+    /**
+     * @brief Removes a segment's name so that the next create() starts with a fresh layout.
+     *
+     * Processes that still have the segment mapped keep using it, but nothing new can attach.
+     * @param name The POSIX shared-memory name.
+     * @throws std::runtime_error if the segment exists but cannot be removed.
+     */
+    static void remove(const std::string& name);
+
+    /**
+     * @brief Destructor for SharedMemorySegment. Unmaps the segment; the segment itself persists.
+     */
+    ~SharedMemorySegment();
+
+    SharedMemorySegment(const SharedMemorySegment&) = delete;
+    SharedMemorySegment& operator=(const SharedMemorySegment&) = delete;
+
+    /**
+     * @brief Gets the number of rings.
+     */
+    uint32_t slotCount() const { return m_header->slotCount; }
+
+    /**
+     * @brief Gets the data capacity of each ring.
+     */
+    uint32_t ringCapacity() const { return m_header->ringCapacity; }
+
+    /**
+     * @brief Gets the control block of a ring.
+     * @param slot The ring index.
+     */
+    SharedRing& ring(uint32_t slot) const;
+
+    /**
+     * @brief Gets the data area of a ring.
+     * @param slot The ring index.
+     */
+    char* data(uint32_t slot) const;
+
+private:
+    SharedMemorySegment(void* address, size_t size);
+
+    /**
+     * @brief Computes the size of one ring including its control block.
+     */
+    static size_t slotSize(uint32_t ringCapacity);
+
+    void* m_address; ///< Start of the mapping.
+    size_t m_size; ///< Size of the mapping.
+    SharedSegmentHeader* m_header; ///< Segment header at the start of the mapping.
+};
+
+} // namespace Core
+
+#endif // SHARED_MEMORY_LOG_H
@@ -0,0 +1,68 @@
+#include "DuplicateFilter.h"
+#include <algorithm>
+#include <functional>
+
+namespace Core {
+
+DuplicateFilter::DuplicateFilter(size_t window, std::chrono::milliseconds summaryInterval)
+    : m_window(std::max<size_t>(window, 1)), m_summaryInterval(summaryInterval) {
+    m_entries.reserve(m_window);
+}
+
+bool DuplicateFilter::suppress(LogLevel level, const char* format, const char* file, int line, const std::string& message,
+                               std::chrono::steady_clock::time_point now, std::vector<Summary>& summaries) {
+    size_t hash = std::hash<std::string>()(message);
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+        if (it->format == format && it->level == level && it->hash == hash && it->message == message) {
+            if (it->repeats++ == 0) {
+                it->firstRepeat = now;
+            }
+            if (now - it->firstRepeat >= m_summaryInterval) {
+                report(*it, summaries);
+            }
+            std::rotate(m_entries.begin(), it, it + 1);
+            return true;
+        }
+    }
+
+    if (m_entries.size() == m_window) {
+        if (m_entries.back().repeats > 0) {
+            report(m_entries.back(), summaries);
+        }
+        m_entries.pop_back();
+    }
+    m_entries.insert(m_entries.begin(), Entry{level, format, file, line, hash, message, 0, now});
+    return false;
+}
+
+void DuplicateFilter::collectDue(std::chrono::steady_clock::time_point now, std::vector<Summary>& summaries) {
+    for (auto& entry : m_entries) {
+        if (entry.repeats > 0 && now - entry.firstRepeat >= m_summaryInterval) {
+            report(entry, summaries);
+        }
+    }
+}
+
+void DuplicateFilter::drain(std::vector<Summary>& summaries) {
+    for (auto& entry : m_entries) {
+        if (entry.repeats > 0) {
+            report(entry, summaries);
+        }
+    }
+    m_entries.clear();
+}
+
+void DuplicateFilter::report(Entry& entry, std::vector<Summary>& summaries) const {
+    // With a window of one the summary always follows the message it counts; otherwise
+    // other messages may come between them, so the summary names the message.
+    std::string text;
+    if (m_window > 1) {
+        text = "message repeated " + std::to_string(entry.repeats) + " times: " + entry.message;
+    } else {
+        text = "previous message repeated " + std::to_string(entry.repeats) + " times";
+    }
+    summaries.push_back(Summary{entry.level, entry.file, entry.line, std::move(text)});
+    entry.repeats = 0;
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+#include "LogClock.h"
+#include <algorithm>
+#include <thread>
+
+namespace Core {
+
+namespace {
+
+constexpr auto kCalibrationPeriod = std::chrono::milliseconds(10);
+constexpr auto kResyncPeriod = std::chrono::seconds(1);
+// While catching up with a backwards step of system_clock, converted time advances at
+// least this much slower than real time: a one-second step is absorbed in ten seconds.
+constexpr double kMaxSlewRate = 0.1;
+
+// Reads ticks on both sides of the clock calls and keeps the midpoint, so the
+// pair is consistent to within the cost of a couple of clock reads.
+void sampleClocks(uint64_t& ticks, std::chrono::system_clock::time_point& system,
+                  std::chrono::steady_clock::time_point& steady) {
+    uint64_t before = TscClock::now();
+    system = std::chrono::system_clock::now();
+    steady = std::chrono::steady_clock::now();
+    uint64_t after = TscClock::now();
+    ticks = before + (after - before) / 2;
+}
+
+}
+
+TscClock::TscClock()
+    : m_anchorTicks(0), m_ticksPerNs(0.0), m_resyncTicks(0), m_slewNs(0.0) {}
+
+bool TscClock::hasInvariantTsc() noexcept {
+#if defined(LOGGER_HAS_RDTSC) && defined(_MSC_VER)
+    int registers[4];
+    __cpuid(registers, 0x80000000);
+    if (static_cast<unsigned>(registers[0]) < 0x80000007u) return false;
+    __cpuid(registers, 0x80000007);
+    return (registers[3] & (1 << 8)) != 0;
+#elif defined(LOGGER_HAS_RDTSC)
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) return false;
+    return (edx & (1u << 8)) != 0;
+#else
+    return false;
+#endif
+}
+
+std::chrono::system_clock::time_point TscClock::toSystemTime(uint64_t ticks) {
+    if (m_ticksPerNs == 0.0) {
+        calibrate();
+    } else if (ticks > m_anchorTicks && ticks - m_anchorTicks >= m_resyncTicks) {
+        resync();
+    }
+
+    auto time = convert(ticks);
+    if (time < m_lastTime) {
+        time = m_lastTime;
+    }
+    m_lastTime = time;
+    return time;
+}
+
+std::chrono::system_clock::time_point TscClock::convert(uint64_t ticks) const {
+    double deltaNs = (static_cast<double>(ticks) - static_cast<double>(m_anchorTicks)) / m_ticksPerNs;
+    double slewNs = std::max(0.0, m_slewNs - kMaxSlewRate * std::max(0.0, deltaNs));
+    return m_anchorTime + std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                              std::chrono::duration<double, std::nano>(deltaNs + slewNs));
+}
+
+void TscClock::calibrate() {
+    uint64_t startTicks;
+    std::chrono::system_clock::time_point startTime;
+    std::chrono::steady_clock::time_point startSteady;
+    sampleClocks(startTicks, startTime, startSteady);
+
+    std::this_thread::sleep_for(kCalibrationPeriod);
+
+    sampleClocks(m_anchorTicks, m_anchorTime, m_anchorSteady);
+    auto elapsedNs = std::chrono::duration<double, std::nano>(m_anchorSteady - startSteady).count();
+    m_ticksPerNs = static_cast<double>(m_anchorTicks - startTicks) / elapsedNs;
+    m_resyncTicks = static_cast<uint64_t>(m_ticksPerNs * std::chrono::duration<double, std::nano>(kResyncPeriod).count());
+}
+
+void TscClock::resync() {
+    uint64_t ticks;
+    std::chrono::system_clock::time_point time;
+    std::chrono::steady_clock::time_point steady;
+    sampleClocks(ticks, time, steady);
+    auto predicted = convert(ticks);
+
+    // The longer baseline since the previous anchor gives a more precise frequency,
+    // and re-anchoring to system_clock picks up any NTP adjustments.
+    auto elapsedNs = std::chrono::duration<double, std::nano>(steady - m_anchorSteady).count();
+    if (elapsedNs > 0.0) {
+        m_ticksPerNs = static_cast<double>(ticks - m_anchorTicks) / elapsedNs;
+    }
+    m_anchorTicks = ticks;
+    m_anchorTime = time;
+    m_anchorSteady = steady;
+    // If system_clock stepped backwards, keep the lead converted time already has and
+    // shed it gradually instead of jumping back; forward steps are applied at once.
+    m_slewNs = std::max(0.0, std::chrono::duration<double, std::nano>(predicted - time).count());
+}
+
+}
\ No newline at end of file
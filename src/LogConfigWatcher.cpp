@@ -0,0 +1,201 @@
+#include "LogConfigWatcher.h"
+#include "LogDestination.h"
+#include "LogFormatter.h"
+#include "LoggerManager.h"
+#include <fstream>
+#include <stdexcept>
+
+namespace Core {
+
+namespace {
+
+std::string trim(const std::string& text) {
+    const char* whitespace = " \t\r\n";
+    size_t begin = text.find_first_not_of(whitespace);
+    if (begin == std::string::npos) return "";
+    size_t end = text.find_last_not_of(whitespace);
+    return text.substr(begin, end - begin + 1);
+}
+
+LogLevel parseLogLevel(const std::string& name) {
+    if (name == "DEBUG") return LogLevel::DEBUG;
+    if (name == "INFO") return LogLevel::INFO;
+    if (name == "WARNING") return LogLevel::WARNING;
+    if (name == "ERROR") return LogLevel::ERROR;
+    if (name == "FATAL") return LogLevel::FATAL;
+    throw std::runtime_error("Unknown log level: " + name);
+}
+
+std::unique_ptr<LogDestination> createDestination(const std::string& spec) {
+    if (spec == "console") {
+        return std::make_unique<ConsoleDestination>();
+    }
+    if (spec == "console:nocolor") {
+        return std::make_unique<ConsoleDestination>(false);
+    }
+    if (spec.compare(0, 5, "file:") == 0) {
+        // file:<path>:<maxFileSize>:<maxFiles>; the path itself may contain ':'.
+        size_t filesSep = spec.rfind(':');
+        size_t sizeSep = spec.rfind(':', filesSep - 1);
+        if (sizeSep > 4 && filesSep > sizeSep) {
+            try {
+                std::string path = spec.substr(5, sizeSep - 5);
+                size_t maxFileSize = std::stoull(spec.substr(sizeSep + 1, filesSep - sizeSep - 1));
+                int maxFiles = std::stoi(spec.substr(filesSep + 1));
+                return std::make_unique<FileDestination>(path, maxFileSize, maxFiles);
+            } catch (const std::logic_error&) {
+                // Fall through to the error below.
+            }
+        }
+    }
+    throw std::runtime_error("Invalid destination: " + spec);
+}
+
+}
+
+LogConfigWatcher::LogConfigWatcher(std::shared_ptr<Logger> logger, const std::string& path,
+                                   std::chrono::milliseconds pollInterval)
+    : m_manager(nullptr), m_logger(std::move(logger)), m_path(path), m_pollInterval(pollInterval), m_running(false) {}
+
+LogConfigWatcher::LogConfigWatcher(LoggerManager& manager, std::shared_ptr<Logger> logger, const std::string& path,
+                                   std::chrono::milliseconds pollInterval)
+    : m_manager(&manager), m_logger(std::move(logger)), m_path(path), m_pollInterval(pollInterval), m_running(false) {}
+
+LogConfigWatcher::~LogConfigWatcher() {
+    stop();
+}
+
+void LogConfigWatcher::start() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_running) return;
+    }
+    reload();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_running = true;
+    m_watchThread = std::thread(&LogConfigWatcher::watch, this);
+}
+
+void LogConfigWatcher::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_running) return;
+        m_running = false;
+    }
+    m_cv.notify_all();
+    if (m_watchThread.joinable()) {
+        m_watchThread.join();
+    }
+}
+
+void LogConfigWatcher::reload() {
+    std::lock_guard<std::mutex> reloadLock(m_reloadMutex);
+    std::error_code ec;
+    auto writeTime = std::filesystem::last_write_time(m_path, ec);
+    std::ifstream file(m_path);
+    if (ec || !file.is_open()) {
+        throw std::runtime_error("Failed to open log configuration: " + m_path);
+    }
+
+    // Parse everything before applying anything, so a bad file changes nothing.
+    bool hasLevel = false;
+    LogLevel level = LogLevel::INFO;
+    bool hasPattern = false;
+    std::string pattern;
+    std::vector<std::string> destinationSpecs;
+    std::map<std::string, LogLevel> categories;
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        line = trim(line);
+        if (line.empty() || line[0] == '#') continue;
+        size_t eq = line.find('=');
+        if (eq == std::string::npos) {
+            throw std::runtime_error(m_path + ":" + std::to_string(lineNumber) + ": expected key = value");
+        }
+        std::string key = trim(line.substr(0, eq));
+        std::string value = trim(line.substr(eq + 1));
+        if (key == "level" && m_manager) {
+            // Setting the logger directly would be overwritten by the manager's next
+            // category change, so the plain level becomes the root category's level.
+            categories[""] = parseLogLevel(value);
+        } else if (key == "level") {
+            level = parseLogLevel(value);
+            hasLevel = true;
+        } else if (key.compare(0, 6, "level.") == 0 && key.size() > 6) {
+            if (!m_manager) {
+                throw std::runtime_error(m_path + ":" + std::to_string(lineNumber) + ": category levels need a LoggerManager");
+            }
+            categories[key.substr(6)] = parseLogLevel(value);
+        } else if (key == "pattern") {
+            pattern = value;
+            hasPattern = true;
+        } else if (key == "destination") {
+            destinationSpecs.push_back(value);
+        } else {
+            throw std::runtime_error(m_path + ":" + std::to_string(lineNumber) + ": unknown key '" + key + "'");
+        }
+    }
+
+    std::vector<std::unique_ptr<LogDestination>> destinations;
+    if (!destinationSpecs.empty() && destinationSpecs != m_appliedDestinations) {
+        for (const auto& spec : destinationSpecs) {
+            destinations.push_back(createDestination(spec));
+        }
+    }
+
+    if (hasLevel) {
+        m_logger->setLogLevel(level);
+    }
+    if (m_manager) {
+        for (const auto& applied : m_appliedCategories) {
+            if (categories.find(applied.first) == categories.end()) {
+                m_manager->resetLevel(applied.first);
+            }
+        }
+        for (const auto& category : categories) {
+            auto applied = m_appliedCategories.find(category.first);
+            if (applied == m_appliedCategories.end() || applied->second != category.second) {
+                m_manager->setLevel(category.first, category.second);
+            }
+        }
+        m_appliedCategories = std::move(categories);
+    }
+    if (hasPattern && pattern != m_appliedPattern) {
+        m_logger->setFormatter(std::make_unique<PatternFormatter>(pattern));
+        m_appliedPattern = pattern;
+    }
+    if (!destinations.empty()) {
+        m_logger->setDestinations(std::move(destinations));
+        m_appliedDestinations = destinationSpecs;
+    }
+    m_lastWriteTime = writeTime;
+}
+
+void LogConfigWatcher::watch() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_cv.wait_for(lock, m_pollInterval, [this] { return !m_running; })) {
+        lock.unlock();
+        std::error_code ec;
+        auto writeTime = std::filesystem::last_write_time(m_path, ec);
+        bool changed;
+        {
+            // Remember the new time even if the reload fails, so a bad file is reported once.
+            std::lock_guard<std::mutex> reloadLock(m_reloadMutex);
+            changed = !ec && writeTime != m_lastWriteTime;
+            m_lastWriteTime = writeTime;
+        }
+        if (changed) {
+            try {
+                reload();
+            } catch (const std::exception& e) {
+                // Keep the previous configuration.
+                LOG_ERROR(m_logger, "Failed to reload log configuration: %s", e.what());
+            }
+        }
+        lock.lock();
+    }
+}
+
+}
@@ -3,8 +3,31 @@
 #include <fstream>
 #include <stdexcept>
 #include <filesystem>
+#include <cstdio>
+#include <ctime>
 
 namespace Core {
+
+namespace {
+
+// Start of the local hour or day containing now, shifted by the given number of periods.
+std::chrono::system_clock::time_point periodStart(RotationInterval interval, int periods) {
+    auto tt = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::tm tm;
+    localtime_r(&tt, &tm);
+    tm.tm_min = 0;
+    tm.tm_sec = 0;
+    if (interval == RotationInterval::Hourly) {
+        tm.tm_hour += periods;
+    } else {
+        tm.tm_hour = 0;
+        tm.tm_mday += periods;
+    }
+    tm.tm_isdst = -1;
+    return std::chrono::system_clock::from_time_t(std::mktime(&tm));
+}
+
+}
 	
 // ConsoleDestination implementation
 ConsoleDestination::ConsoleDestination(bool useColor) : m_useColor(useColor) {}
@@ -24,8 +47,16 @@ void ConsoleDestination::flush() {
 
 // FileDestination implementation
 FileDestination::FileDestination(const std::string& filename, size_t maxFileSize, int maxFiles)
-    : m_filename(filename), m_maxFileSize(maxFileSize), m_maxFiles(maxFiles) {
+    : FileDestination(filename, FileRotationPolicy{maxFileSize, maxFiles}) {}
+
+FileDestination::FileDestination(const std::string& filename, const FileRotationPolicy& policy)
+    : m_filename(filename), m_policy(policy), m_sequence(1), m_currentSize(0), m_retainedSize(0) {
+    recoverSegments();
     openLogFile();
+    updateCurrentLink();
+    enforceRetention();
+    scheduleNextRotation();
+    rotateIfStale();
 }
 
 FileDestination::~FileDestination() {
@@ -38,8 +69,16 @@ void FileDestination::write(const std::string& message) {
     if (!m_logFile.is_open()) {
         openLogFile();
     }
+    if (m_policy.interval != RotationInterval::None && std::chrono::system_clock::now() >= m_nextRotation) {
+        if (m_currentSize > 0) {
+            rotateLogFiles();
+        } else {
+            scheduleNextRotation();
+        }
+    }
     m_logFile << message << std::endl;
-    if (m_logFile.tellp() > static_cast<std::streampos>(m_maxFileSize)) {
+    m_currentSize += message.size() + 1;
+    if (m_currentSize > m_policy.maxFileSize) {
         rotateLogFiles();
     }
 }
@@ -51,23 +90,100 @@ void FileDestination::flush() {
 }
 
 void FileDestination::openLogFile() {
-    m_logFile.open(m_filename, std::ios::app);
+    std::string path = segmentPath(m_sequence);
+    m_logFile.open(path, std::ios::app);
     if (!m_logFile.is_open()) {
-        throw std::runtime_error("Failed to open log file: " + m_filename);
+        throw std::runtime_error("Failed to open log file: " + path);
     }
+    std::error_code ec;
+    auto size = std::filesystem::file_size(path, ec);
+    m_currentSize = ec ? 0 : static_cast<size_t>(size);
 }
 
 void FileDestination::rotateLogFiles() {
     m_logFile.close();
-    for (int i = m_maxFiles - 1; i > 0; --i) {
-        std::filesystem::path oldName = std::filesystem::path(m_filename).replace_extension("." + std::to_string(i));
-        std::filesystem::path newName = std::filesystem::path(m_filename).replace_extension("." + std::to_string(i + 1));
-        if (std::filesystem::exists(oldName)) {
-            std::filesystem::rename(oldName, newName);
+    m_retained.emplace_back(m_sequence, m_currentSize);
+    m_retainedSize += m_currentSize;
+    ++m_sequence;
+    openLogFile();
+    updateCurrentLink();
+    enforceRetention();
+    scheduleNextRotation();
+}
+
+void FileDestination::recoverSegments() {
+    std::error_code ec;
+    auto status = std::filesystem::symlink_status(m_filename, ec);
+    if (std::filesystem::is_symlink(status)) {
+        std::string target = std::filesystem::read_symlink(m_filename, ec).filename().string();
+        size_t dot = target.rfind('.');
+        if (!ec && dot != std::string::npos && dot + 1 < target.size() &&
+            target.find_first_not_of("0123456789", dot + 1) == std::string::npos) {
+            m_sequence = std::stoull(target.substr(dot + 1));
         }
+    } else if (std::filesystem::exists(status)) {
+        // A plain log file from before segments were used becomes the first segment.
+        std::filesystem::rename(m_filename, segmentPath(m_sequence));
+    }
+
+    // Segments are contiguous, so walking back from the current one finds every
+    // retained segment without listing the directory. The walk continues past
+    // maxFiles so that segments kept under a larger limit are tracked, and then
+    // deleted by enforceRetention().
+    for (uint64_t sequence = m_sequence; sequence > 1;) {
+        --sequence;
+        auto size = std::filesystem::file_size(segmentPath(sequence), ec);
+        if (ec) break;
+        m_retained.emplace_front(sequence, static_cast<size_t>(size));
+        m_retainedSize += static_cast<size_t>(size);
+    }
+}
+
+std::string FileDestination::segmentPath(uint64_t sequence) const {
+    char suffix[24];
+    std::snprintf(suffix, sizeof(suffix), ".%06llu", static_cast<unsigned long long>(sequence));
+    return m_filename + suffix;
+}
+
+void FileDestination::updateCurrentLink() {
+    // Create the new link beside the old one and rename it over, so readers never see it missing.
+    std::filesystem::path link(m_filename);
+    std::filesystem::path temporary(m_filename + ".link");
+    std::error_code ec;
+    std::filesystem::remove(temporary, ec);
+    std::filesystem::create_symlink(std::filesystem::path(segmentPath(m_sequence)).filename(), temporary);
+    std::filesystem::rename(temporary, link);
+}
+
+void FileDestination::enforceRetention() {
+    auto exceedsLimits = [this] {
+        if (static_cast<int>(m_retained.size()) + 1 > m_policy.maxFiles) return true;
+        return m_policy.maxTotalSize != 0 && m_retainedSize + m_currentSize > m_policy.maxTotalSize;
+    };
+    while (!m_retained.empty() && exceedsLimits()) {
+        std::error_code ec;
+        std::filesystem::remove(segmentPath(m_retained.front().first), ec);
+        m_retainedSize -= m_retained.front().second;
+        m_retained.pop_front();
+    }
+}
+
+void FileDestination::scheduleNextRotation() {
+    if (m_policy.interval == RotationInterval::None) return;
+    m_nextRotation = periodStart(m_policy.interval, 1);
+}
+
+void FileDestination::rotateIfStale() {
+    if (m_policy.interval == RotationInterval::None || m_currentSize == 0) return;
+    std::error_code ec;
+    auto writeTime = std::filesystem::last_write_time(segmentPath(m_sequence), ec);
+    if (ec) return;
+    // file_clock cannot be converted to system_clock before C++20, so compare ages instead.
+    auto age = std::filesystem::file_time_type::clock::now() - writeTime;
+    auto lastWrite = std::chrono::system_clock::now() - std::chrono::duration_cast<std::chrono::system_clock::duration>(age);
+    if (lastWrite < periodStart(m_policy.interval, 0)) {
+        rotateLogFiles();
     }
-    std::filesystem::rename(m_filename, std::filesystem::path(m_filename).replace_extension(".1"));
-    openLogFile();
 }
 
 }
\ No newline at end of file
@@ -0,0 +1,171 @@
+#include "LoggerCore.h"
+#include "LogFormatter.h"
+#include "LogDestination.h"
+
+Logger::Logger()
+    : m_logLevel(LogLevel::INFO), m_clockMode(ClockMode::System),
+      m_sinks(std::make_shared<const Sinks>(Sinks{std::make_shared<PatternFormatter>("[%Y-%m-%d %H:%M:%S] [%l] %v"), {}})),
+      m_sinksGeneration(0), m_activeSinks(m_sinks), m_activeGeneration(0), m_running(false) {}
+
+Logger::~Logger() {
+    stop();
+    // Records logged while the logger was stopped still hold memory budget shared with other loggers.
+    drainQueue(false);
+}
+
+void Logger::setLogLevel(LogLevel level) {
+    m_logLevel.store(level, std::memory_order_relaxed);
+}
+
+template<typename Modify>
+void Logger::updateSinks(Modify modify) {
+    std::lock_guard<std::mutex> lock(m_configMutex);
+    auto sinks = std::make_shared<Sinks>(*std::atomic_load(&m_sinks));
+    modify(*sinks);
+    std::atomic_store(&m_sinks, std::shared_ptr<const Sinks>(std::move(sinks)));
+    m_sinksGeneration.fetch_add(1, std::memory_order_release);
+}
+
+void Logger::addDestination(std::unique_ptr<LogDestination> destination) {
+    std::shared_ptr<LogDestination> shared(std::move(destination));
+    updateSinks([&shared](Sinks& sinks) { sinks.destinations.push_back(std::move(shared)); });
+}
+
+void Logger::setDestinations(std::vector<std::unique_ptr<LogDestination>> destinations) {
+    updateSinks([&destinations](Sinks& sinks) {
+        sinks.destinations.clear();
+        for (auto& destination : destinations) {
+            sinks.destinations.push_back(std::move(destination));
+        }
+    });
+}
+
+void Logger::setFormatter(std::unique_ptr<LogFormatter> formatter) {
+    std::shared_ptr<const LogFormatter> shared(std::move(formatter));
+    updateSinks([&shared](Sinks& sinks) { sinks.formatter = std::move(shared); });
+}
+
+void Logger::setClockMode(ClockMode mode) {
+    m_clockMode.store(mode, std::memory_order_relaxed);
+}
+
+void Logger::setMemoryBudget(std::shared_ptr<MemoryBudget> budget) {
+    m_memoryBudget = std::move(budget);
+}
+
+void Logger::setDuplicateSuppression(size_t window, std::chrono::milliseconds summaryInterval) {
+    if (window == 0) {
+        m_duplicateFilter.reset();
+    } else {
+        m_duplicateFilter = std::make_unique<DuplicateFilter>(window, summaryInterval);
+    }
+}
+
+void Logger::start() {
+    bool expected = false;
+    if (!m_running.compare_exchange_strong(expected, true)) return;
+    m_workerThread = std::thread(&Logger::processLogQueue, this);
+}
+
+void Logger::stop() {
+    bool expected = true;
+    if (!m_running.compare_exchange_strong(expected, false)) return;
+    LogRecord sentinel{};
+    sentinel.shutdown = true;
+    m_logQueue.enqueue(std::move(sentinel));
+    if (m_workerThread.joinable()) {
+        m_workerThread.join();
+    }
+    // Records logged concurrently with stop() may have landed behind the shutdown marker.
+    drainQueue(true);
+    refreshSinks();
+    for (auto& destination : m_activeSinks->destinations) {
+        destination->flush();
+    }
+}
+
+void Logger::processLogQueue() {
+    std::vector<DuplicateFilter::Summary> summaries;
+    auto lastCollect = std::chrono::steady_clock::now();
+    for (;;) {
+        LogRecord record;
+        if (!m_duplicateFilter) {
+            record = m_logQueue.dequeue();
+        } else if (!m_logQueue.dequeueFor(record, m_duplicateFilter->summaryInterval())) {
+            // Idle: report floods that stopped without a different message following them.
+            lastCollect = std::chrono::steady_clock::now();
+            m_duplicateFilter->collectDue(lastCollect, summaries);
+            writeSummaries(summaries);
+            continue;
+        }
+        if (record.shutdown) break;
+
+        bool suppressed = false;
+        if (m_duplicateFilter) {
+            auto now = std::chrono::steady_clock::now();
+            suppressed = m_duplicateFilter->suppress(record.level, record.format, record.file, record.line,
+                                                     record.message, now, summaries);
+            // A flood that stopped while other messages keep arriving never makes the queue idle,
+            // so due summaries are also collected on a timer.
+            if (now - lastCollect >= m_duplicateFilter->summaryInterval()) {
+                m_duplicateFilter->collectDue(now, summaries);
+                lastCollect = now;
+            }
+            writeSummaries(summaries);
+        }
+        if (!suppressed) {
+            writeRecord(record);
+        }
+        if (record.budgetBytes != 0) {
+            m_memoryBudget->release(record.budgetBytes);
+        }
+    }
+    if (m_duplicateFilter) {
+        m_duplicateFilter->drain(summaries);
+        writeSummaries(summaries);
+    }
+}
+
+void Logger::drainQueue(bool write) {
+    LogRecord record;
+    while (m_logQueue.tryDequeue(record)) {
+        if (record.shutdown) continue;
+        if (write) {
+            writeRecord(record);
+        }
+        if (record.budgetBytes != 0) {
+            m_memoryBudget->release(record.budgetBytes);
+        }
+    }
+}
+
+void Logger::writeRecord(const LogRecord& record) {
+    auto timestamp = record.clockMode == ClockMode::Tsc ? m_tscClock.toSystemTime(record.ticks) : record.timestamp;
+    writeMessage(record.level, timestamp, record.file, record.line, record.message);
+}
+
+void Logger::refreshSinks() {
+    uint64_t generation = m_sinksGeneration.load(std::memory_order_acquire);
+    if (generation == m_activeGeneration) return;
+    for (auto& destination : m_activeSinks->destinations) {
+        destination->flush();
+    }
+    m_activeSinks = std::atomic_load(&m_sinks);
+    m_activeGeneration = generation;
+}
+
+void Logger::writeSummaries(std::vector<DuplicateFilter::Summary>& summaries) {
+    for (auto& summary : summaries) {
+        writeMessage(summary.level, std::chrono::system_clock::now(), summary.file, summary.line, summary.message);
+    }
+    summaries.clear();
+}
+
+void Logger::writeMessage(LogLevel level, const std::chrono::system_clock::time_point& timestamp,
+                          const char* file, int line, const std::string& message) {
+    refreshSinks();
+    std::string formattedMessage = m_activeSinks->formatter->format(level, timestamp, file, line, message);
+    for (auto& destination : m_activeSinks->destinations) {
+        destination->writeTimestamped(formattedMessage, timestamp);
+    }
+}
@@ -9,6 +9,8 @@ std::shared_ptr<Logger> LoggerManager::createLogger(const std::string& name) {
         return it->second;
     } else {
         auto logger = std::make_shared<Logger>();
+        logger->setLogLevel(resolveLevel(name));
+        logger->setMemoryBudget(m_memoryBudget);
         m_loggers[name] = logger;
         return logger;
     }
@@ -28,4 +30,56 @@ void LoggerManager::removeLogger(const std::string& name) {
     m_loggers.erase(name);
 }
 
+void LoggerManager::setLevel(const std::string& category, LogLevel level) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_levels[category] = level;
+    applyLevels(category);
+}
+
+void LoggerManager::resetLevel(const std::string& category) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_levels.erase(category) > 0) {
+        applyLevels(category);
+    }
+}
+
+LogLevel LoggerManager::getEffectiveLevel(const std::string& category) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return resolveLevel(category);
+}
+
+void LoggerManager::setMemoryBudget(size_t limitBytes, const MemoryBudget::Policy& policy) {
+    m_memoryBudget->configure(limitBytes, policy);
+}
+
+MemoryBudget::Stats LoggerManager::getMemoryStats() const {
+    return m_memoryBudget->stats();
+}
+
+LogLevel LoggerManager::resolveLevel(const std::string& category) const {
+    std::string current = category;
+    for (;;) {
+        auto it = m_levels.find(current);
+        if (it != m_levels.end()) {
+            return it->second;
+        }
+        if (current.empty()) {
+            return LogLevel::INFO;
+        }
+        size_t dot = current.rfind('.');
+        current.erase(dot == std::string::npos ? 0 : dot);
+    }
+}
+
+void LoggerManager::applyLevels(const std::string& category) {
+    // m_loggers is ordered, so the subtree of a category is a contiguous range
+    // starting at the category itself.
+    for (auto it = m_loggers.lower_bound(category); it != m_loggers.end(); ++it) {
+        const std::string& name = it->first;
+        if (name.compare(0, category.size(), category) != 0) break;
+        if (!category.empty() && name.size() > category.size() && name[category.size()] != '.') continue;
+        it->second->setLogLevel(resolveLevel(name));
+    }
+}
+
 }
\ No newline at end of file
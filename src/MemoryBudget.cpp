@@ -0,0 +1,124 @@
+#include "MemoryBudget.h"
+
+namespace Core {
+
+MemoryBudget::MemoryBudget()
+    : m_limit(0), m_dropThreshold(0), m_sampleThreshold(0), m_warningSampleRate(1), m_blockTimeoutMs(0),
+      m_used(0), m_peak(0), m_warningCounter(0), m_droppedDebug(0), m_droppedInfo(0), m_sampledWarnings(0),
+      m_droppedWarnings(0), m_blockedProducers(0), m_blockTimeouts(0), m_waiters(0) {}
+
+void MemoryBudget::configure(size_t limitBytes, const Policy& policy) {
+    m_dropThreshold.store(static_cast<size_t>(limitBytes * policy.dropDebugInfoAt), std::memory_order_relaxed);
+    m_sampleThreshold.store(static_cast<size_t>(limitBytes * policy.sampleWarningAt), std::memory_order_relaxed);
+    m_warningSampleRate.store(policy.warningSampleRate > 0 ? policy.warningSampleRate : 1, std::memory_order_relaxed);
+    m_blockTimeoutMs.store(policy.blockTimeout.count(), std::memory_order_relaxed);
+    m_limit.store(limitBytes, std::memory_order_relaxed);
+    // A raised limit may let blocked producers through.
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cv.notify_all();
+}
+
+bool MemoryBudget::admits(LogLevel level) {
+    size_t limit = m_limit.load(std::memory_order_relaxed);
+    if (limit == 0) return true;
+    size_t used = m_used.load(std::memory_order_relaxed);
+    switch (level) {
+        case LogLevel::DEBUG:
+        case LogLevel::INFO:
+            if (used > m_dropThreshold.load(std::memory_order_relaxed)) {
+                (level == LogLevel::DEBUG ? m_droppedDebug : m_droppedInfo).fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            break;
+        case LogLevel::WARNING:
+            if (used > limit) {
+                m_droppedWarnings.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            break;
+        case LogLevel::ERROR:
+        case LogLevel::FATAL:
+            break;
+    }
+    return true;
+}
+
+bool MemoryBudget::acquire(LogLevel level, size_t bytes) {
+    size_t limit = m_limit.load(std::memory_order_relaxed);
+    if (limit == 0) {
+        charge(bytes);
+        return true;
+    }
+    size_t used = m_used.load(std::memory_order_relaxed) + bytes;
+
+    switch (level) {
+        case LogLevel::DEBUG:
+        case LogLevel::INFO:
+            if (used > m_dropThreshold.load(std::memory_order_relaxed)) {
+                (level == LogLevel::DEBUG ? m_droppedDebug : m_droppedInfo).fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            break;
+        case LogLevel::WARNING:
+            if (used > limit) {
+                m_droppedWarnings.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            if (used > m_sampleThreshold.load(std::memory_order_relaxed) &&
+                m_warningCounter.fetch_add(1, std::memory_order_relaxed) % m_warningSampleRate.load(std::memory_order_relaxed) != 0) {
+                m_sampledWarnings.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            break;
+        case LogLevel::ERROR:
+        case LogLevel::FATAL:
+            if (used > limit) {
+                m_blockedProducers.fetch_add(1, std::memory_order_relaxed);
+                auto timeout = std::chrono::milliseconds(m_blockTimeoutMs.load(std::memory_order_relaxed));
+                std::unique_lock<std::mutex> lock(m_mutex);
+                // Sequentially consistent with release(), so either it sees the waiter or we see the freed memory.
+                m_waiters.fetch_add(1);
+                bool admitted = m_cv.wait_for(lock, timeout, [this, bytes] {
+                    size_t currentLimit = m_limit.load(std::memory_order_relaxed);
+                    return currentLimit == 0 || m_used.load() + bytes <= currentLimit;
+                });
+                m_waiters.fetch_sub(1);
+                if (!admitted) {
+                    m_blockTimeouts.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            break;
+    }
+    charge(bytes);
+    return true;
+}
+
+void MemoryBudget::release(size_t bytes) {
+    m_used.fetch_sub(bytes);
+    if (m_waiters.load() > 0) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cv.notify_all();
+    }
+}
+
+MemoryBudget::Stats MemoryBudget::stats() const {
+    return Stats{
+        m_used.load(std::memory_order_relaxed),
+        m_peak.load(std::memory_order_relaxed),
+        m_droppedDebug.load(std::memory_order_relaxed),
+        m_droppedInfo.load(std::memory_order_relaxed),
+        m_sampledWarnings.load(std::memory_order_relaxed),
+        m_droppedWarnings.load(std::memory_order_relaxed),
+        m_blockedProducers.load(std::memory_order_relaxed),
+        m_blockTimeouts.load(std::memory_order_relaxed)
+    };
+}
+
+void MemoryBudget::charge(size_t bytes) {
+    size_t used = m_used.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    size_t peak = m_peak.load(std::memory_order_relaxed);
+    while (used > peak && !m_peak.compare_exchange_weak(peak, used, std::memory_order_relaxed)) {
+    }
+}
+
+}
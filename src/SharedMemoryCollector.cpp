@@ -0,0 +1,164 @@
+#include "SharedMemoryCollector.h"
+#include <cerrno>
+#include <cstring>
+#include <signal.h>
+
+namespace Core {
+
+namespace {
+
+constexpr auto kProducerCheckPeriod = std::chrono::seconds(1);
+
+constexpr uint64_t alignRecord(uint64_t size) {
+    return (size + 7) & ~uint64_t(7);
+}
+
+bool processExists(int32_t pid) {
+    return kill(pid, 0) == 0 || errno != ESRCH;
+}
+
+}
+
+SharedMemoryCollector::SharedMemoryCollector(const std::string& segmentName, uint32_t slotCount, uint32_t ringCapacity,
+                                             std::chrono::milliseconds pollInterval)
+    : m_segment(SharedMemorySegment::create(segmentName, slotCount, ringCapacity)),
+      m_pollInterval(pollInterval), m_running(false) {}
+
+SharedMemoryCollector::~SharedMemoryCollector() {
+    stop();
+}
+
+void SharedMemoryCollector::addDestination(std::unique_ptr<LogDestination> destination) {
+    m_destinations.push_back(std::move(destination));
+}
+
+void SharedMemoryCollector::start() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_running) return;
+    m_running = true;
+    m_collectThread = std::thread(&SharedMemoryCollector::run, this);
+}
+
+void SharedMemoryCollector::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_running) return;
+        m_running = false;
+    }
+    m_cv.notify_all();
+    if (m_collectThread.joinable()) {
+        m_collectThread.join();
+    }
+    collect();
+    checkProducers();
+    for (auto& destination : m_destinations) {
+        destination->flush();
+    }
+}
+
+void SharedMemoryCollector::run() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_running) {
+        lock.unlock();
+        size_t written = collect();
+        auto now = std::chrono::steady_clock::now();
+        if (now - m_lastProducerCheck >= kProducerCheckPeriod) {
+            checkProducers();
+            m_lastProducerCheck = now;
+        }
+        if (written > 0) {
+            for (auto& destination : m_destinations) {
+                destination->flush();
+            }
+        }
+        lock.lock();
+        if (written == 0) {
+            m_cv.wait_for(lock, m_pollInterval, [this] { return !m_running; });
+        }
+    }
+}
+
+size_t SharedMemoryCollector::collect() {
+    const uint32_t slotCount = m_segment->slotCount();
+    const uint64_t mask = m_segment->ringCapacity() - 1;
+    // Only records published before this call are taken, so a busy producer cannot keep us here forever.
+    std::vector<uint64_t> heads(slotCount);
+    std::vector<SharedRecordHeader> fronts(slotCount);
+    std::vector<bool> pending(slotCount);
+    for (uint32_t slot = 0; slot < slotCount; ++slot) {
+        heads[slot] = m_segment->ring(slot).head.load(std::memory_order_acquire);
+        pending[slot] = peek(slot, heads[slot], fronts[slot]);
+    }
+
+    // k-way merge by log time: a ring holds its process's records in queue order, which matches
+    // log time except for threads racing to enqueue, so repeatedly taking the oldest front suffices.
+    size_t written = 0;
+    std::string message;
+    for (;;) {
+        uint32_t oldest = slotCount;
+        for (uint32_t slot = 0; slot < slotCount; ++slot) {
+            if (pending[slot] && (oldest == slotCount || fronts[slot].timestamp < fronts[oldest].timestamp)) {
+                oldest = slot;
+            }
+        }
+        if (oldest == slotCount) break;
+
+        SharedRing& ring = m_segment->ring(oldest);
+        uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+        const char* payload = m_segment->data(oldest) + (tail & mask) + sizeof(SharedRecordHeader);
+        message.assign(payload, fronts[oldest].size);
+        ring.tail.store(tail + alignRecord(sizeof(SharedRecordHeader) + fronts[oldest].size), std::memory_order_release);
+        std::chrono::system_clock::time_point timestamp(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(fronts[oldest].timestamp)));
+        writeMessage(message, timestamp);
+        ++written;
+        pending[oldest] = peek(oldest, heads[oldest], fronts[oldest]);
+    }
+    return written;
+}
+
+bool SharedMemoryCollector::peek(uint32_t slot, uint64_t head, SharedRecordHeader& header) {
+    SharedRing& ring = m_segment->ring(slot);
+    const uint64_t capacity = m_segment->ringCapacity();
+    const char* data = m_segment->data(slot);
+    uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+    while (tail != head) {
+        uint64_t offset = tail & (capacity - 1);
+        std::memcpy(&header.size, data + offset, sizeof(header.size));
+        if (header.size != SharedRecordHeader::kPaddingMarker) {
+            std::memcpy(&header, data + offset, sizeof(header));
+            return true;
+        }
+        tail += capacity - offset;
+        ring.tail.store(tail, std::memory_order_release);
+    }
+    return false;
+}
+
+void SharedMemoryCollector::checkProducers() {
+    for (uint32_t slot = 0; slot < m_segment->slotCount(); ++slot) {
+        SharedRing& ring = m_segment->ring(slot);
+        // Taking the count resets it, so drops made while no collector was running are reported once.
+        uint64_t dropped = ring.dropped.exchange(0, std::memory_order_relaxed);
+        if (dropped != 0) {
+            writeMessage("shared memory ring " + std::to_string(slot) + " dropped " + std::to_string(dropped) + " records",
+                         std::chrono::system_clock::now());
+        }
+
+        int32_t owner = ring.owner.load(std::memory_order_acquire);
+        if (owner != 0 && !processExists(owner) &&
+            ring.head.load(std::memory_order_acquire) == ring.tail.load(std::memory_order_relaxed)) {
+            // The producer crashed; everything it published has been collected.
+            ring.owner.compare_exchange_strong(owner, 0, std::memory_order_acq_rel);
+        }
+    }
+}
+
+void SharedMemoryCollector::writeMessage(const std::string& message,
+                                         const std::chrono::system_clock::time_point& timestamp) {
+    for (auto& destination : m_destinations) {
+        destination->writeTimestamped(message, timestamp);
+    }
+}
+
+}
@@ -0,0 +1,72 @@
+#include "SharedMemoryDestination.h"
+#include <stdexcept>
+#include <cstring>
+#include <unistd.h>
+
+namespace Core {
+
+namespace {
+
+constexpr uint64_t alignRecord(uint64_t size) {
+    return (size + 7) & ~uint64_t(7);
+}
+
+}
+
+SharedMemoryDestination::SharedMemoryDestination(const std::string& segmentName)
+    : m_segment(SharedMemorySegment::attach(segmentName)), m_slot(0), m_ring(nullptr), m_data(nullptr),
+      m_mask(m_segment->ringCapacity() - 1) {
+    int32_t pid = static_cast<int32_t>(getpid());
+    for (uint32_t slot = 0; slot < m_segment->slotCount(); ++slot) {
+        int32_t expected = 0;
+        if (m_segment->ring(slot).owner.compare_exchange_strong(expected, pid, std::memory_order_acq_rel)) {
+            m_slot = slot;
+            m_ring = &m_segment->ring(slot);
+            m_data = m_segment->data(slot);
+            return;
+        }
+    }
+    throw std::runtime_error("No free ring in shared memory segment " + segmentName);
+}
+
+SharedMemoryDestination::~SharedMemoryDestination() {
+    m_ring->owner.store(0, std::memory_order_release);
+}
+
+void SharedMemoryDestination::write(const std::string& message) {
+    writeTimestamped(message, std::chrono::system_clock::now());
+}
+
+void SharedMemoryDestination::writeTimestamped(const std::string& message,
+                                               const std::chrono::system_clock::time_point& timestamp) {
+    const uint64_t capacity = m_mask + 1;
+    // Oversized messages are truncated so one record can never occupy the whole ring.
+    uint32_t size = static_cast<uint32_t>(std::min<uint64_t>(message.size(), capacity / 4));
+    uint64_t recordSize = alignRecord(sizeof(SharedRecordHeader) + size);
+
+    uint64_t head = m_ring->head.load(std::memory_order_relaxed);
+    uint64_t tail = m_ring->tail.load(std::memory_order_acquire);
+    uint64_t offset = head & m_mask;
+    uint64_t padding = capacity - offset < recordSize ? capacity - offset : 0;
+    if (head + padding + recordSize - tail > capacity) {
+        m_ring->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    if (padding != 0) {
+        SharedRecordHeader marker{SharedRecordHeader::kPaddingMarker, 0, 0};
+        std::memcpy(m_data + offset, &marker, sizeof(marker.size));
+        head += padding;
+        offset = 0;
+    }
+    auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(timestamp.time_since_epoch()).count();
+    SharedRecordHeader header{size, 0, static_cast<int64_t>(nanoseconds)};
+    std::memcpy(m_data + offset, &header, sizeof(header));
+    std::memcpy(m_data + offset + sizeof(header), message.data(), size);
+    // Publishing head last means a crash mid-write never exposes a partial record.
+    m_ring->head.store(head + recordSize, std::memory_order_release);
+}
+
+void SharedMemoryDestination::flush() {}
+
+}
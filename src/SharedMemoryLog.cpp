@@ -0,0 +1,131 @@
+#include "SharedMemoryLog.h"
+#include <stdexcept>
+#include <cstring>
+#include <cerrno>
+#include <new>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Core {
+
+namespace {
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "shared-memory rings need lock-free 64-bit atomics");
+static_assert(std::atomic<int32_t>::is_always_lock_free, "shared-memory rings need lock-free 32-bit atomics");
+
+constexpr size_t kHeaderSize = 64;
+static_assert(sizeof(SharedSegmentHeader) <= kHeaderSize, "segment header must fit before the first ring");
+
+uint32_t roundUpToPowerOfTwo(uint32_t value) {
+    uint32_t result = 4096;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+void* mapSegment(int fd, size_t size, const std::string& name) {
+    void* address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (address == MAP_FAILED) {
+        close(fd);
+        throw std::runtime_error("Failed to map shared memory segment " + name + ": " + std::strerror(errno));
+    }
+    close(fd);
+    return address;
+}
+
+}
+
+size_t SharedMemorySegment::slotSize(uint32_t ringCapacity) {
+    return sizeof(SharedRing) + ringCapacity;
+}
+
+std::unique_ptr<SharedMemorySegment> SharedMemorySegment::create(const std::string& name, uint32_t slotCount,
+                                                                 uint32_t ringCapacity) {
+    ringCapacity = roundUpToPowerOfTwo(ringCapacity);
+    size_t size = kHeaderSize + slotCount * slotSize(ringCapacity);
+
+    int fd = shm_open(name.c_str(), O_RDWR | O_CREAT, 0660);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to open shared memory segment " + name + ": " + std::strerror(errno));
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        throw std::runtime_error("Failed to stat shared memory segment " + name + ": " + std::strerror(errno));
+    }
+    bool exists = st.st_size != 0;
+    if (exists && static_cast<size_t>(st.st_size) != size) {
+        close(fd);
+        throw std::runtime_error("Shared memory segment " + name + " exists with a different size");
+    }
+    if (!exists && ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        close(fd);
+        throw std::runtime_error("Failed to size shared memory segment " + name + ": " + std::strerror(errno));
+    }
+
+    std::unique_ptr<SharedMemorySegment> segment(new SharedMemorySegment(mapSegment(fd, size, name), size));
+    SharedSegmentHeader* header = segment->m_header;
+    if (header->magic.load(std::memory_order_acquire) == SharedSegmentHeader::kMagic) {
+        // Reattaching after a collector restart: keep the rings and whatever they still hold.
+        if (header->slotCount != slotCount || header->ringCapacity != ringCapacity) {
+            throw std::runtime_error("Shared memory segment " + name + " exists with a different layout");
+        }
+        return segment;
+    }
+
+    // ftruncate zero-fills, which is a valid initial state for every ring.
+    header->slotCount = slotCount;
+    header->ringCapacity = ringCapacity;
+    for (uint32_t slot = 0; slot < slotCount; ++slot) {
+        new (&segment->ring(slot)) SharedRing();
+    }
+    header->magic.store(SharedSegmentHeader::kMagic, std::memory_order_release);
+    return segment;
+}
+
+std::unique_ptr<SharedMemorySegment> SharedMemorySegment::attach(const std::string& name) {
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to open shared memory segment " + name + ": " + std::strerror(errno));
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < kHeaderSize) {
+        close(fd);
+        throw std::runtime_error("Shared memory segment " + name + " is not initialized");
+    }
+    size_t size = static_cast<size_t>(st.st_size);
+    std::unique_ptr<SharedMemorySegment> segment(new SharedMemorySegment(mapSegment(fd, size, name), size));
+    SharedSegmentHeader* header = segment->m_header;
+    if (header->magic.load(std::memory_order_acquire) != SharedSegmentHeader::kMagic ||
+        kHeaderSize + header->slotCount * slotSize(header->ringCapacity) != size) {
+        throw std::runtime_error("Shared memory segment " + name + " is not initialized");
+    }
+    return segment;
+}
+
+void SharedMemorySegment::remove(const std::string& name) {
+    if (shm_unlink(name.c_str()) != 0 && errno != ENOENT) {
+        throw std::runtime_error("Failed to remove shared memory segment " + name + ": " + std::strerror(errno));
+    }
+}
+
+SharedMemorySegment::SharedMemorySegment(void* address, size_t size)
+    : m_address(address), m_size(size), m_header(static_cast<SharedSegmentHeader*>(address)) {}
+
+SharedMemorySegment::~SharedMemorySegment() {
+    munmap(m_address, m_size);
+}
+
+SharedRing& SharedMemorySegment::ring(uint32_t slot) const {
+    char* base = static_cast<char*>(m_address) + kHeaderSize + slot * slotSize(m_header->ringCapacity);
+    return *reinterpret_cast<SharedRing*>(base);
+}
+
+char* SharedMemorySegment::data(uint32_t slot) const {
+    return reinterpret_cast<char*>(&ring(slot)) + sizeof(SharedRing);
+}
+
+}
@@ -0,0 +1,56 @@
+#include <iostream>
+#include <atomic>
+#include <csignal>
+#include <thread>
+#include "LogDestination.h"
+#include "SharedMemoryCollector.h"
+#include <cstring>
+
+namespace {
+
+std::atomic<bool> g_stopRequested(false);
+
+void handleSignal(int) {
+    g_stopRequested.store(true);
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    const char* program = argv[0];
+    // With --unlink the segment is removed after a clean shutdown, so the next run may use a different layout.
+    bool unlink = argc > 1 && std::strcmp(argv[1], "--unlink") == 0;
+    if (unlink) {
+        --argc;
+        ++argv;
+    }
+    if (argc != 2 && argc != 5) {
+        std::cerr << "Usage: " << program << " [--unlink] <segment> [<file> <maxFileSize> <maxFiles>]" << std::endl;
+        return 1;
+    }
+
+    try {
+        Core::SharedMemoryCollector collector(argv[1]);
+        if (argc == 5) {
+            collector.addDestination(std::make_unique<Core::FileDestination>(
+                argv[2], std::stoull(argv[3]), std::stoi(argv[4])));
+        } else {
+            collector.addDestination(std::make_unique<Core::ConsoleDestination>(false));
+        }
+
+        std::signal(SIGINT, handleSignal);
+        std::signal(SIGTERM, handleSignal);
+        collector.start();
+        while (!g_stopRequested.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        collector.stop();
+        if (unlink) {
+            Core::SharedMemorySegment::remove(argv[1]);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << program << ": " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}